@@ -0,0 +1,246 @@
+#pragma once
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <exception>
+#include <cstddef>
+#include "ReadOnlyStream.hpp"
+#include "Exceptions.hpp"
+
+// Читает ReadOnlyStream заранее в фоновом потоке: кольцо из bufferCount
+// буферов по chunkSize элементов, поток-читатель заполняет свободные,
+// Read забирает готовые. Пока потребитель обрабатывает один буфер,
+// следующий уже читается с диска, и Read ждёт только если обработка
+// быстрее чтения. Это ожидание копится в GetStallTime/GetStallCount.
+//
+// Закрытый источник Open открывает сам, уже открытый читается с текущей
+// позиции. После Open исходным потоком пользуется только фоновый поток;
+// трогать его напрямую до Close нельзя, Close закрывает его. Ошибка чтения в фоне выбрасывается из Read
+// после того, как отданы все порции, прочитанные до неё (порция с ошибкой
+// пропадает целиком, как и у ReadOnlyStream::Read(out, n)).
+template <typename T>
+class PrefetchReadStream {
+public:
+    static constexpr size_t DefaultChunkSize = 1 << 14;
+    static constexpr size_t DefaultBufferCount = 3;
+
+    explicit PrefetchReadStream(ReadOnlyStream<T>& source,
+                                size_t chunkSize = DefaultChunkSize,
+                                size_t bufferCount = DefaultBufferCount)
+        : source(source),
+          chunkSize(chunkSize > 0 ? chunkSize : 1),
+          slots(bufferCount > 1 ? bufferCount : 2),
+          position(0), isOpen(false) {}
+
+    PrefetchReadStream(const PrefetchReadStream&) = delete;
+    PrefetchReadStream& operator=(const PrefetchReadStream&) = delete;
+
+    void Open() {
+        Close();
+        if (!source.IsOpen()) {
+            source.Open();
+        }
+        for (Slot& slot : slots) {
+            slot.items.resize(chunkSize);
+            slot.count = 0;
+        }
+        head = tail = ready = 0;
+        current = nullptr;
+        offset = 0;
+        finished = stopping = false;
+        error = nullptr;
+        position = 0;
+        stallTime = std::chrono::nanoseconds(0);
+        stallCount = 0;
+        isOpen = true;
+        reader = std::thread(&PrefetchReadStream::ReadAhead, this);
+    }
+
+    void Close() {
+        if (reader.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            slotFree.notify_one();
+            reader.join();
+        }
+        if (isOpen) {
+            source.Close();
+        }
+        current = nullptr;
+        isOpen = false;
+    }
+
+    T Read() {
+        if (!isOpen) {
+            throw StreamNotOpenException();
+        }
+        if (!Acquire()) {
+            throw EndOfStreamException();
+        }
+        position++;
+        return current->items[offset++];
+    }
+
+    // Читает до n элементов в out; возвращает, сколько прочитано (меньше n - конец потока)
+    size_t Read(T* out, size_t n) {
+        if (!isOpen) {
+            throw StreamNotOpenException();
+        }
+        size_t count = 0;
+        while (count < n && Acquire()) {
+            size_t chunk = current->count - offset;
+            if (chunk > n - count) {
+                chunk = n - count;
+            }
+            for (size_t i = 0; i < chunk; i++) {
+                out[count + i] = current->items[offset + i];
+            }
+            offset += chunk;
+            count += chunk;
+        }
+        position += count;
+        return count;
+    }
+
+    bool IsEndOfStream() {
+        if (!isOpen) {
+            throw StreamNotOpenException();
+        }
+        return !Acquire();
+    }
+
+    size_t GetPosition() const {
+        return position;
+    }
+
+    bool IsCanSeek() const {
+        return false;
+    }
+
+    bool IsCanGoBack() const {
+        return false;
+    }
+
+    // Сколько всего Read ждал фоновое чтение
+    std::chrono::nanoseconds GetStallTime() const {
+        return stallTime;
+    }
+
+    // Сколько раз Read застал кольцо пустым
+    size_t GetStallCount() const {
+        return stallCount;
+    }
+
+    ~PrefetchReadStream() {
+        try {
+            Close();
+        } catch (...) {
+        }
+    }
+
+private:
+    struct Slot {
+        std::vector<T> items;
+        size_t count = 0;
+    };
+
+    // Фоновый поток: заполняет свободные буферы, пока источник не кончится
+    void ReadAhead() {
+        while (true) {
+            Slot* slot;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                slotFree.wait(lock, [this] { return stopping || ready < slots.size(); });
+                if (stopping) {
+                    return;
+                }
+                slot = &slots[tail];
+            }
+
+            size_t count = 0;
+            std::exception_ptr failure;
+            try {
+                count = source.Read(slot->items.data(), chunkSize);
+            } catch (...) {
+                failure = std::current_exception();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                slot->count = count;
+                if (count > 0) {
+                    tail = (tail + 1) % slots.size();
+                    ready++;
+                }
+                if (failure || count < chunkSize) {
+                    error = failure;
+                    finished = true;
+                }
+            }
+            slotFilled.notify_one();
+            if (failure || count < chunkSize) {
+                return;
+            }
+        }
+    }
+
+    // Делает current буфером с непрочитанными элементами; false - конец потока
+    bool Acquire() {
+        if (current && offset < current->count) {
+            return true;
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        if (current) {
+            // Прочитанный буфер возвращается фоновому потоку
+            current = nullptr;
+            head = (head + 1) % slots.size();
+            ready--;
+            slotFree.notify_one();
+        }
+        if (ready == 0 && !finished) {
+            auto start = std::chrono::steady_clock::now();
+            slotFilled.wait(lock, [this] { return ready > 0 || finished; });
+            stallTime += std::chrono::steady_clock::now() - start;
+            stallCount++;
+        }
+        if (ready == 0) {
+            if (error) {
+                std::exception_ptr failure = error;
+                error = nullptr;
+                std::rethrow_exception(failure);
+            }
+            return false;
+        }
+        current = &slots[head];
+        offset = 0;
+        return true;
+    }
+
+    ReadOnlyStream<T>& source;
+    size_t chunkSize;
+    std::vector<Slot> slots;
+
+    std::thread reader;
+    std::mutex mutex;
+    std::condition_variable slotFree;
+    std::condition_variable slotFilled;
+    size_t head = 0;    // первый заполненный буфер (его читает потребитель)
+    size_t tail = 0;    // следующий буфер для фонового потока
+    size_t ready = 0;   // заполненных буферов, включая current
+    bool finished = false;
+    bool stopping = false;
+    std::exception_ptr error;
+
+    Slot* current = nullptr;
+    size_t offset = 0;
+
+    std::chrono::nanoseconds stallTime{0};
+    size_t stallCount = 0;
+
+    size_t position;
+    bool isOpen;
+};
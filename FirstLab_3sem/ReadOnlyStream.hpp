@@ -1,92 +1,197 @@
 #pragma once
 #include <vector>
 #include <fstream>
+#include <sstream>
+#include <string>
 #include <cstddef>
+#include <cstring>
+#include <charconv>
+#include <type_traits>
 #include "Exceptions.hpp"
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define READ_STREAM_MMAP 1
+#endif
+
+// Buffered - текстовый файл, Mapped - двоичный файл из подряд идущих T
+enum class StreamFileMode { Buffered, Mapped };
+
+// Файловый режим Buffered читает файл блоками по bufferSize байт и разбирает
+// элементы прямо из буфера: числа - std::from_chars, char - байт как есть
+// (пробелы и переводы строк тоже элементы), std::string - слово до пробела,
+// остальные типы - operator>> над одним словом.
+//
+// Режим Mapped отображает файл в память (mmap): элемент - sizeof(T) байт
+// (для char - один байт текста), T должен быть тривиально копируемым.
+// Seek/GoBack/GetPosition работают за O(1) для файла любого размера,
+// в память попадают только прочитанные страницы.
 template <typename T>
 class ReadOnlyStream {
 public:
-    explicit ReadOnlyStream(std::vector<T>* seq) 
+    static constexpr size_t DefaultBufferSize = 1 << 16;
+
+    explicit ReadOnlyStream(std::vector<T>* seq)
         : data(seq), isMemory(true), position(0), isOpen(false) {}
-    
-    explicit ReadOnlyStream(const std::string& filename)
-        : filename(filename), isMemory(false), position(0), isOpen(false) {}
-    
+
+    explicit ReadOnlyStream(const std::string& filename, size_t bufferSize = DefaultBufferSize)
+        : filename(filename), bufferSize(bufferSize), isMemory(false), position(0), isOpen(false) {}
+
+    ReadOnlyStream(const std::string& filename, StreamFileMode mode, size_t bufferSize = DefaultBufferSize)
+        : filename(filename), bufferSize(bufferSize), fileMode(mode), isMemory(false), position(0), isOpen(false) {}
+
+    ReadOnlyStream(const ReadOnlyStream&) = delete;
+    ReadOnlyStream& operator=(const ReadOnlyStream&) = delete;
+
     void Open() {
         if (isMemory) {
             isOpen = true;
+        } else if (fileMode == StreamFileMode::Mapped) {
+            Map();
+            position = 0;
+            isOpen = true;
         } else {
-            file.open(filename);
+            file.open(filename, std::ios::binary);
             if (!file.is_open()) {
                 throw StreamException("Cannot open file: " + filename);
             }
+            buffer.resize(bufferSize > 0 ? bufferSize : 1);
+            begin = end = 0;
             isOpen = true;
         }
     }
-    
+
     void Close() {
         if (!isMemory && file.is_open()) {
             file.close();
         }
+        Unmap();
+        buffer.clear();
+        buffer.shrink_to_fit();
+        begin = end = 0;
         isOpen = false;
     }
-    
+
+    bool IsOpen() const {
+        return isOpen;
+    }
+
+    // Размер блока чтения; действует со следующего Open
+    void SetBufferSize(size_t size) {
+        bufferSize = size;
+    }
+
+    size_t GetBufferSize() const {
+        return bufferSize;
+    }
+
     T Read() {
         if (!isOpen) {
             throw StreamNotOpenException();
         }
-        
-        if (IsEndOfStream()) {
-            throw EndOfStreamException();
-        }
-        
+
         T element;
-        
+
         if (isMemory) {
+            if (IsEndOfStream()) {
+                throw EndOfStreamException();
+            }
             element = (*data)[position];
-        } else {
-            if (!(file >> element)) {
+        } else if (fileMode == StreamFileMode::Mapped) {
+            if (position >= mappedCount) {
                 throw EndOfStreamException();
             }
+            CopyMapped(&element, position, 1);
+        } else if (!ParseNext(element)) {
+            throw EndOfStreamException();
         }
-        
+
         position++;
         return element;
     }
-    
+
+    // Читает до n элементов в out; возвращает, сколько прочитано (меньше n - конец потока)
+    size_t Read(T* out, size_t n) {
+        if (!isOpen) {
+            throw StreamNotOpenException();
+        }
+
+        size_t count = 0;
+        if (isMemory) {
+            size_t available = data->size() - position;
+            count = n < available ? n : available;
+            for (size_t i = 0; i < count; i++) {
+                out[i] = (*data)[position + i];
+            }
+        } else if (fileMode == StreamFileMode::Mapped) {
+            size_t available = mappedCount - position;
+            count = n < available ? n : available;
+            CopyMapped(out, position, count);
+        } else if constexpr (std::is_same<T, char>::value) {
+            while (count < n && (begin < end || Fill())) {
+                size_t chunk = end - begin;
+                if (chunk > n - count) {
+                    chunk = n - count;
+                }
+                std::memcpy(out + count, buffer.data() + begin, chunk);
+                begin += chunk;
+                count += chunk;
+            }
+        } else {
+            while (count < n && ParseNext(out[count])) {
+                count++;
+            }
+        }
+
+        position += count;
+        return count;
+    }
+
     bool IsEndOfStream() const {
         if (isMemory) {
             return position >= data->size();
+        } else if (fileMode == StreamFileMode::Mapped) {
+            return position >= mappedCount;
+        } else if constexpr (std::is_same<T, char>::value) {
+            return begin == end && !Fill();
         } else {
-            return file.eof() || file.fail();
+            return !SkipSpace();
         }
     }
-    
+
     size_t GetPosition() const {
         return position;
     }
-    
+
     bool IsCanSeek() const {
-        return isMemory;
+        return isMemory || fileMode == StreamFileMode::Mapped;
     }
-    
+
     bool IsCanGoBack() const {
-        return isMemory;
+        return isMemory || fileMode == StreamFileMode::Mapped;
+    }
+
+    // Число элементов; известно для памяти и для Mapped после Open
+    size_t GetLength() const {
+        return isMemory ? data->size() : mappedCount;
     }
-    
+
     size_t Seek(size_t index) {
         if (!IsCanSeek()) {
             throw SeekNotSupportedException();
         }
-        if (index >= data->size()) {
-            position = data->size();
+        size_t length = GetLength();
+        if (index >= length) {
+            position = length;
         } else {
             position = index;
         }
         return position;
     }
-    
+
     bool GoBack(size_t steps = 1) {
         if (!IsCanGoBack()) {
             throw GoBackNotSupportedException();
@@ -97,16 +202,174 @@ public:
         }
         return false;
     }
-    
+
     ~ReadOnlyStream() {
         Close();
     }
-    
+
 private:
+    void Map() {
+        if constexpr (!std::is_trivially_copyable<T>::value) {
+            throw StreamException("Mapped mode needs a trivially copyable element type");
+        }
+        Unmap();
+#ifdef READ_STREAM_MMAP
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw StreamException("Cannot open file: " + filename);
+        }
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            throw StreamException("Cannot open file: " + filename);
+        }
+        size_t size = static_cast<size_t>(info.st_size);
+        if (size % sizeof(T) != 0) {
+            ::close(fd);
+            throw StreamException("File size is not a multiple of the element size: " + filename);
+        }
+        if (size > 0) {
+            void* address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (address == MAP_FAILED) {
+                ::close(fd);
+                throw StreamException("Cannot map file: " + filename);
+            }
+            ::madvise(address, size, MADV_SEQUENTIAL);
+            mapped = static_cast<const char*>(address);
+        }
+        ::close(fd);
+        mappedSize = size;
+        mappedCount = size / sizeof(T);
+#else
+        throw StreamException("Memory-mapped files are not supported on this platform");
+#endif
+    }
+
+    void Unmap() {
+#ifdef READ_STREAM_MMAP
+        if (mapped) {
+            ::munmap(const_cast<char*>(mapped), mappedSize);
+        }
+#endif
+        mapped = nullptr;
+        mappedSize = 0;
+        mappedCount = 0;
+    }
+
+    void CopyMapped(T* out, size_t first, size_t count) const {
+        // У пустого файла отображения нет: mapped == nullptr
+        if (count == 0) {
+            return;
+        }
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            std::memcpy(out, mapped + first * sizeof(T), count * sizeof(T));
+        }
+    }
+
+    static bool IsSpace(char c) {
+        return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+    }
+
+    // Сдвигает непрочитанный хвост в начало буфера и дочитывает блок; false - файл кончился
+    bool Fill() const {
+        if (!file.is_open()) {
+            return false;
+        }
+        if (begin > 0) {
+            std::memmove(buffer.data(), buffer.data() + begin, end - begin);
+            end -= begin;
+            begin = 0;
+        }
+        if (end == buffer.size()) {
+            buffer.resize(buffer.size() * 2);
+        }
+        file.read(buffer.data() + end, static_cast<std::streamsize>(buffer.size() - end));
+        size_t got = static_cast<size_t>(file.gcount());
+        end += got;
+        return got > 0;
+    }
+
+    // Пропускает пробелы; false, если до конца файла слов больше нет
+    bool SkipSpace() const {
+        while (true) {
+            while (begin < end && IsSpace(buffer[begin])) {
+                begin++;
+            }
+            if (begin < end) {
+                return true;
+            }
+            if (!Fill()) {
+                return false;
+            }
+        }
+    }
+
+    // Следующее слово [first, last) прямо в буфере; слово длиннее буфера увеличивает буфер
+    bool NextToken(const char*& first, const char*& last) {
+        if (!SkipSpace()) {
+            return false;
+        }
+        size_t length = 0;
+        while (true) {
+            while (begin + length < end && !IsSpace(buffer[begin + length])) {
+                length++;
+            }
+            if (begin + length < end || !Fill()) {
+                break;
+            }
+        }
+        first = buffer.data() + begin;
+        last = first + length;
+        begin += length;
+        return true;
+    }
+
+    bool ParseNext(T& element) {
+        if constexpr (std::is_same<T, char>::value) {
+            if (begin == end && !Fill()) {
+                return false;
+            }
+            element = buffer[begin++];
+            return true;
+        } else {
+            const char* first;
+            const char* last;
+            if (!NextToken(first, last)) {
+                return false;
+            }
+            if constexpr (std::is_arithmetic<T>::value && !std::is_same<T, bool>::value) {
+                // from_chars не принимает '+'; "+-5" остаётся ошибкой
+                if (last - first > 1 && first[0] == '+' && first[1] != '-') {
+                    first++;
+                }
+                auto result = std::from_chars(first, last, element);
+                if (result.ec != std::errc() || result.ptr != last) {
+                    throw StreamException("Cannot parse element: " + std::string(first, last));
+                }
+            } else if constexpr (std::is_same<T, std::string>::value) {
+                element.assign(first, last);
+            } else {
+                std::istringstream token(std::string(first, last));
+                if (!(token >> element)) {
+                    throw StreamException("Cannot parse element: " + std::string(first, last));
+                }
+            }
+            return true;
+        }
+    }
+
     std::vector<T>* data = nullptr;
     std::string filename;
     mutable std::ifstream file;
-    
+    mutable std::vector<char> buffer;
+    mutable size_t begin = 0;
+    mutable size_t end = 0;
+    size_t bufferSize = DefaultBufferSize;
+    StreamFileMode fileMode = StreamFileMode::Buffered;
+    const char* mapped = nullptr;
+    size_t mappedSize = 0;
+    size_t mappedCount = 0;
+
     bool isMemory;
     size_t position;
     bool isOpen;
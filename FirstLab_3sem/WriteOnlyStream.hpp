@@ -1,65 +1,241 @@
 #pragma once
 #include <vector>
-#include <fstream>
+#include <string>
+#include <sstream>
+#include <cstdio>
 #include <cstddef>
+#include <chrono>
+#include <charconv>
+#include <type_traits>
 #include "Exceptions.hpp"
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#define WRITE_STREAM_FSYNC 1
+#endif
+
+// Когда буфер файлового режима уходит в файл:
+//   Never      - только по Flush/Sync/Close (буфер растёт сколько нужно)
+//   OnSize     - когда накопилось bufferSize байт (по умолчанию)
+//   OnInterval - как OnSize, и ещё если с прошлого сброса прошло flushInterval
+//                (проверяется только в Write: простаивающий поток сам не сбрасывается,
+//                для этого нужен Flush)
+//   EveryN     - как OnSize, и ещё после каждых flushEvery записей
+enum class FlushPolicy { Never, OnSize, OnInterval, EveryN };
+
+// Файловый режим пишет записи "элемент\n" в свой буфер и отдаёт его ОС
+// одним системным вызовом по политике FlushPolicy. Числа форматируются
+// std::to_chars (double - кратчайшая запись без потери точности).
+// Flush передаёт данные ОС, Sync дополнительно ждёт записи на диск (fsync);
+// без них после падения процесса последние записи могут пропасть.
+// Ошибку записи остатка буфера сообщает только явный Close: деструктор её глотает.
 template <typename T>
 class WriteOnlyStream {
 public:
+    static constexpr size_t DefaultBufferSize = 1 << 16;
+
     explicit WriteOnlyStream(std::vector<T>* seq)
         : data(seq), isMemory(true), position(0), isOpen(false) {}
-    
-    explicit WriteOnlyStream(const std::string& filename)
-        : filename(filename), isMemory(false), position(0), isOpen(false) {}
-    
+
+    explicit WriteOnlyStream(const std::string& filename, size_t bufferSize = DefaultBufferSize)
+        : filename(filename), bufferSize(bufferSize), isMemory(false), position(0), isOpen(false) {}
+
+    WriteOnlyStream(const WriteOnlyStream&) = delete;
+    WriteOnlyStream& operator=(const WriteOnlyStream&) = delete;
+
+    // Повторный Open сначала закрывает уже открытый файл
     void Open() {
+        Close();
         if (isMemory) {
             isOpen = true;
         } else {
-            file.open(filename, std::ios::app);
-            if (!file.is_open()) {
+            file = std::fopen(filename.c_str(), "ab");
+            if (!file) {
                 throw StreamException("Cannot open file for writing: " + filename);
             }
+            // Буферизация только своя: stdio не должен копить данные второй раз
+            std::setvbuf(file, nullptr, _IONBF, 0);
+            buffer.reserve(bufferSize);
+            lastFlush = std::chrono::steady_clock::now();
+            sinceFlush = 0;
             isOpen = true;
         }
     }
-    
+
+    // Файл закрывается, даже если остаток буфера записать не удалось
     void Close() {
-        if (!isMemory && file.is_open()) {
-            file.close();
-        }
         isOpen = false;
+        if (isMemory || !file) {
+            return;
+        }
+        try {
+            WriteBuffer();
+        } catch (...) {
+            std::fclose(file);
+            file = nullptr;
+            buffer.clear();
+            throw;
+        }
+        bool closed = std::fclose(file) == 0;
+        file = nullptr;
+        if (!closed) {
+            throw StreamException("Cannot close file: " + filename);
+        }
+    }
+
+    void SetFlushPolicy(FlushPolicy policy) {
+        flushPolicy = policy;
+    }
+
+    // Для EveryN: сбрасывать после каждых records записей
+    void SetFlushEvery(size_t records) {
+        flushEvery = records > 0 ? records : 1;
     }
-    
+
+    // Для OnInterval: сбрасывать, если с прошлого сброса прошло interval
+    void SetFlushInterval(std::chrono::milliseconds interval) {
+        flushInterval = interval;
+    }
+
     size_t Write(const T& element) {
         if (!isOpen) {
             throw StreamNotOpenException();
         }
-        
+
         if (isMemory) {
             data->push_back(element);
         } else {
-            file << element << "\n";
-            file.flush();
+            Format(element);
+            sinceFlush++;
+            ApplyPolicy();
         }
-        
+
         return ++position;
     }
-    
+
+    // Пишет n элементов; политика проверяется один раз в конце,
+    // переполнение буфера - по ходу
+    size_t Write(const T* items, size_t n) {
+        if (!isOpen) {
+            throw StreamNotOpenException();
+        }
+
+        if (isMemory) {
+            data->insert(data->end(), items, items + n);
+        } else {
+            for (size_t i = 0; i < n; i++) {
+                Format(items[i]);
+                sinceFlush++;
+                if (flushPolicy != FlushPolicy::Never && buffer.size() >= bufferSize) {
+                    WriteBuffer();
+                }
+            }
+            ApplyPolicy();
+        }
+
+        position += n;
+        return position;
+    }
+
+    // Отдаёт накопленные записи ОС
+    void Flush() {
+        if (!isOpen) {
+            throw StreamNotOpenException();
+        }
+        if (!isMemory) {
+            WriteBuffer();
+        }
+    }
+
+    // Flush и ожидание записи на диск
+    void Sync() {
+        Flush();
+#ifdef WRITE_STREAM_FSYNC
+        if (!isMemory && ::fsync(fileno(file)) != 0) {
+            throw StreamException("Cannot sync file: " + filename);
+        }
+#endif
+    }
+
     size_t GetPosition() const {
         return position;
     }
-    
+
+    // Байт в буфере, ещё не отданных ОС
+    size_t GetBufferedBytes() const {
+        return buffer.size();
+    }
+
     ~WriteOnlyStream() {
-        Close();
+        try {
+            Close();
+        } catch (...) {
+        }
     }
-    
+
 private:
+    void Format(const T& element) {
+        if constexpr (std::is_arithmetic<T>::value && !std::is_same<T, bool>::value &&
+                      !std::is_same<T, char>::value) {
+            char digits[64];
+            auto result = std::to_chars(digits, digits + sizeof(digits), element);
+            buffer.append(digits, result.ptr);
+        } else if constexpr (std::is_same<T, char>::value) {
+            buffer.push_back(element);
+        } else if constexpr (std::is_same<T, std::string>::value) {
+            buffer.append(element);
+        } else {
+            std::ostringstream out;
+            out << element;
+            buffer.append(out.str());
+        }
+        buffer.push_back('\n');
+    }
+
+    void ApplyPolicy() {
+        bool due = false;
+        switch (flushPolicy) {
+        case FlushPolicy::Never:
+            break;
+        case FlushPolicy::OnSize:
+            due = buffer.size() >= bufferSize;
+            break;
+        case FlushPolicy::OnInterval:
+            due = buffer.size() >= bufferSize ||
+                  std::chrono::steady_clock::now() - lastFlush >= flushInterval;
+            break;
+        case FlushPolicy::EveryN:
+            due = buffer.size() >= bufferSize || sinceFlush >= flushEvery;
+            break;
+        }
+        if (due) {
+            WriteBuffer();
+        }
+    }
+
+    void WriteBuffer() {
+        if (!buffer.empty()) {
+            if (std::fwrite(buffer.data(), 1, buffer.size(), file) != buffer.size()) {
+                throw StreamException("Cannot write file: " + filename);
+            }
+            buffer.clear();
+        }
+        lastFlush = std::chrono::steady_clock::now();
+        sinceFlush = 0;
+    }
+
     std::vector<T>* data = nullptr;
     std::string filename;
-    std::ofstream file;
-    
+    std::FILE* file = nullptr;
+    std::string buffer;
+    size_t bufferSize = DefaultBufferSize;
+
+    FlushPolicy flushPolicy = FlushPolicy::OnSize;
+    size_t flushEvery = 1;
+    std::chrono::milliseconds flushInterval{1000};
+    std::chrono::steady_clock::time_point lastFlush;
+    size_t sinceFlush = 0;
+
     bool isMemory;
     size_t position;
     bool isOpen;
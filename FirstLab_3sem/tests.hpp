@@ -10,6 +10,15 @@
 #include "Boyer-Moore-Horspool.hpp"
 #include "SpaceRemover.hpp"
 #include "SpellChecker.hpp"
+#include "ReadOnlyStream.hpp"
+#include "WriteOnlyStream.hpp"
+#include "PrefetchReadStream.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <chrono>
+#include <thread>
 
 class AlgorithmTests {
 public:
@@ -50,6 +59,15 @@ public:
         totalTests += 10;  // Увеличено с 7 до 10
         passedTests += spellPassed;
 
+        // Тесты потоков
+        std::cout << "\n═══════════════════════════════════════════════════════════════════\n";
+        std::cout << "4. ПОТОКИ: отображение в память, буферизованные чтение и запись, упреждающее чтение\n";
+        std::cout << "═══════════════════════════════════════════════════════════════════\n\n";
+
+        auto streamPassed = TestStreams();
+        totalTests += 19;
+        passedTests += streamPassed;
+
         // Итоги
         std::cout << "\n═══════════════════════════════════════════════════════════════════\n";
         std::cout << "ИТОГОВЫЕ РЕЗУЛЬТАТЫ\n";
@@ -561,4 +579,474 @@ private:
 
         return passed;
     }
+
+    // ════════════════════════════════════════════════════════════════
+    // ТЕСТЫ ПОТОКОВ
+    // ════════════════════════════════════════════════════════════════
+
+    static void WriteBinary(const char* path, const void* data, size_t bytes) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+    }
+
+    static size_t FileSize(const char* path) {
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        return in ? static_cast<size_t>(in.tellg()) : 0;
+    }
+
+    static int TestStreams() {
+        int passed = 0;
+        const char* path = "stream_test.bin";
+
+        // Тест 1: Mapped - длина, чтение, Seek и GoBack
+        {
+            int values[] = {10, 20, 30, 40, 50};
+            WriteBinary(path, values, sizeof(values));
+            ReadOnlyStream<int> stream(path, StreamFileMode::Mapped);
+            stream.Open();
+            int first = stream.Read();
+            stream.Seek(3);
+            int fourth = stream.Read();
+            bool back = stream.GoBack(2);
+            int third = stream.Read();
+            int rest[5];
+            size_t got = stream.Read(rest, 5);
+            stream.Seek(100);
+            if (stream.GetLength() == 5 && first == 10 && fourth == 40 && back && third == 30 &&
+                got == 2 && rest[0] == 40 && rest[1] == 50 && stream.IsEndOfStream() &&
+                stream.GetPosition() == 5 && !stream.GoBack(6)) {
+                std::cout << "  ✓ Test 1: Mapped - GetLength, Seek, GoBack\n";
+                passed++;
+            } else {
+                std::cout << "  ⨯ Test 1 FAILED: неверное чтение или позиционирование в Mapped\n";
+            }
+        }
+
+        // Тест 2: Mapped - пустой файл
+        {
+            WriteBinary(path, "", 0);
+            ReadOnlyStream<int> stream(path, StreamFileMode::Mapped);
+            stream.Open();
+            int out[4];
+            bool ended = false;
+            try {
+                stream.Read();
+            } catch (const EndOfStreamException&) {
+                ended = true;
+            }
+            if (stream.GetLength() == 0 && stream.Read(out, 4) == 0 && stream.IsEndOfStream() && ended) {
+                std::cout << "  ✓ Test 2: Mapped - пустой файл\n";
+                passed++;
+            } else {
+                std::cout << "  ⨯ Test 2 FAILED: пустой файл прочитан неверно\n";
+            }
+        }
+
+        // Тест 3: Mapped - размер файла не кратен sizeof(T)
+        {
+            WriteBinary(path, "abcdefg", 7);
+            ReadOnlyStream<int> stream(path, StreamFileMode::Mapped);
+            bool thrown = false;
+            try {
+                stream.Open();
+            } catch (const StreamException&) {
+                thrown = true;
+            }
+            if (thrown) {
+                std::cout << "  ✓ Test 3: Mapped - размер не кратен элементу\n";
+                passed++;
+            } else {
+                std::cout << "  ⨯ Test 3 FAILED: ожидалось исключение при размере 7 байт\n";
+            }
+        }
+
+        // Тест 4: Mapped - нетривиально копируемый тип
+        {
+            ReadOnlyStream<std::string> stream(path, StreamFileMode::Mapped);
+            bool thrown = false;
+            try {
+                stream.Open();
+            } catch (const StreamException&) {
+                thrown = true;
+            }
+            if (thrown) {
+                std::cout << "  ✓ Test 4: Mapped - std::string отклонён\n";
+                passed++;
+            } else {
+                std::cout << "  ⨯ Test 4 FAILED: Mapped принял нетривиальный тип\n";
+            }
+        }
+
+        const char* textPath = "stream_test.txt";
+        std::remove(textPath);
+
+        // Тест 5: Buffered char - пробелы и переводы строк тоже элементы
+        {
+            const char text[] = "a b\n\tc";
+            WriteBinary(textPath, text, sizeof(text) - 1);
+            ReadOnlyStream<char> stream(textPath, 2);
+            stream.Open();
+            std::string got;
+            while (!stream.IsEndOfStream()) {
+                got += stream.Read();
+            }
+            if (got == "a b\n\tc" && stream.GetPosition() == 6) {
+                std::cout << "  ✓ Test 5: Buffered char - пробельные байты\n";
+                passed++;
+            } else {
+                std::cout << "  ⨯ Test 5 FAILED: char пропустил пробельные байты\n";
+            }
+        }
+
+        // Тест 6: Buffered char - пакетное чтение через несколько блоков
+        {
+            std::string text;
+            for (int i = 0; i < 100; i++) {
+                text += static_cast<char>('a' + i % 26);
+                text += (i % 7 == 0) ? '\n' : ' ';
+            }
+            WriteBinary(textPath, text.data(), text.size());
+            ReadOnlyStream<char> stream(textPath, 8);
+            stream.Open();
+            std::vector<char> out(300);
+            size_t head = stream.Read(out.data(), 13);
+            size_t rest = stream.Read(out.data() + head, out.size() - head);
+            if (head == 13 && head + rest == text.size() &&
+                std::string(out.data(), head + rest) == text && stream.IsEndOfStream()) {
+                std::cout << "  ✓ Test 6: Buffered char - Read(out, n)\n";
+                passed++;
+            } else {
+                std::cout << "  ⨯ Test 6 FAILED: пакетное чтение char потеряло байты\n";
+            }
+        }
+
+        // Тест 7: Buffered - числа на стыке блоков маленького буфера
+        {
+            const char text[] = "12 345\n6789\t10  -11 0.5";
+            WriteBinary(textPath, text, sizeof(text) - 1);
+            ReadOnlyStream<double> stream(textPath, 4);
+            stream.Open();
+            double expected[] = {12, 345, 6789, 10, -11, 0.5};
+            double got[8];
+            size_t count = stream.Read(got, 8);
+            bool same = count == 6;
+            for (size_t i = 0; same && i < count; i++) {
+                same = got[i] == expected[i];
+            }
+            if (same && stream.IsEndOfStream()) {
+                std::cout << "  ✓ Test 7: Buffered - слова на стыке блоков\n";
+                passed++;
+            } else {
+                std::cout << "  ⨯ Test 7 FAILED: слово на стыке блоков разорвано\n";
+            }
+        }
+
+        // Тест 8: Buffered - слово длиннее буфера увеличивает буфер
+        {
+            std::string word(50, 'x');
+            std::string text = "ab " + word + " cd";
+            WriteBinary(textPath, text.data(), text.size());
+            ReadOnlyStream<std::string> stream(textPath, 3);
+            stream.Open();
+            bool words = stream.Read() == "ab" && stream.Read() == word && stream.Read() == "cd";
+
+            const char digits[] = " 1234567890123 7";
+            WriteBinary(textPath, digits, sizeof(digits) - 1);
+            ReadOnlyStream<long long> numbers(textPath, 2);
+            numbers.Open();
+            bool number = numbers.Read() == 1234567890123LL && numbers.Read() == 7 && numbers.IsEndOfStream();
+            if (words && number) {
+                std::cout << "  ✓ Test 8: Buffered - слово длиннее буфера\n";
+                passed++;
+            } else {
+                std::cout << "  ⨯ Test 8 FAILED: длинное слово прочитано неверно\n";
+            }
+        }
+
+        // Тест 9: Buffered - ведущий '+', ошибка разбора и переполнение
+        {
+            const char text[] = "+7 -8 +0";
+            WriteBinary(textPath, text, sizeof(text) - 1);
+            ReadOnlyStream<int> stream(textPath);
+            stream.Open();
+            bool signs = stream.Read() == 7 && stream.Read() == -8 && stream.Read() == 0;
+
+            const char* bad[] = {"12a", "99999999999", "+-5", "+", "-"};
+            int rejected = 0;
+            for (const char* item : bad) {
+                WriteBinary(textPath, item, std::strlen(item));
+                ReadOnlyStream<int> broken(textPath);
+                broken.Open();
+                try {
+                    broken.Read();
+                } catch (const EndOfStreamException&) {
+                } catch (const StreamException&) {
+                    rejected++;
+                }
+            }
+            if (signs && rejected == 5) {
+                std::cout << "  ✓ Test 9: Buffered - знак, ошибка разбора, переполнение\n";
+                passed++;
+            } else {
+                std::cout << "  ⨯ Test 9 FAILED: принято неверное число\n";
+            }
+        }
+
+        // Тест 10: OnSize - запись копится до bufferSize, пачка сбрасывается по ходу
+        {
+            std::remove(textPath);
+            WriteOnlyStream<int> stream(textPath, 16);
+            stream.Open();
+            stream.Write(1);
+            stream.Write(22);
+            bool buffered = FileSize(textPath) == 0 && stream.GetBufferedBytes() == 5;
+            int batch[] = {333, 4444, 55555};
+            size_t position = stream.Write(batch, 3);
+            bool flushed = FileSize(textPath) == 20 && stream.GetBufferedBytes() == 0;
+            stream.Close();
+            if (buffered && flushed && position == 5) {
+                std::cout << "  ✓ Test 10: OnSize и пакетная запись\n";
+                passed++;
+            } else {
+                std::cout << "  ⨯ Test 10 FAILED: буфер OnSize сброшен не вовремя\n";
+            }
+        }
+
+        // Тест 11: EveryN - сброс после каждых N записей, в том числе внутри пачки
+        {
+            std::remove(textPath);
+            WriteOnlyStream<int> stream(textPath);
+            stream.SetFlushPolicy(FlushPolicy::EveryN);
+            stream.SetFlushEvery(2);
+            stream.Open();
+            stream.Write(6);
+            bool waiting = stream.GetBufferedBytes() == 2;
+            stream.Write(7);
+            bool flushed = stream.GetBufferedBytes() == 0 && FileSize(textPath) == 4;
+            int batch[] = {8, 9, 1};
+            stream.Write(batch, 3);
+            bool afterBatch = stream.GetBufferedBytes() == 0 && FileSize(textPath) == 10;
+            stream.Close();
+            if (waiting && flushed && afterBatch) {
+                std::cout << "  ✓ Test 11: EveryN\n";
+                passed++;
+            } else {
+                std::cout << "  ⨯ Test 11 FAILED: EveryN сбрасывает не каждые N записей\n";
+            }
+        }
+
+        // Тест 12: Never - только Flush/Sync
+        {
+            std::remove(textPath);
+            WriteOnlyStream<int> stream(textPath, 16);
+            stream.SetFlushPolicy(FlushPolicy::Never);
+            stream.Open();
+            for (int i = 0; i < 100; i++) {
+                stream.Write(i);
+            }
+            bool held = FileSize(textPath) == 0 && stream.GetBufferedBytes() == 290;
+            stream.Sync();
+            bool synced = FileSize(textPath) == 290 && stream.GetBufferedBytes() == 0;
+            stream.Close();
+            if (held && synced) {
+                std::cout << "  ✓ Test 12: Never и Sync\n";
+                passed++;
+            } else {
+                std::cout << "  ⨯ Test 12 FAILED: Never сбросил буфер сам или Sync не записал его\n";
+            }
+        }
+
+        // Тест 13: OnInterval - сброс при записи после паузы
+        {
+            std::remove(textPath);
+            WriteOnlyStream<int> stream(textPath);
+            stream.SetFlushPolicy(FlushPolicy::OnInterval);
+            stream.SetFlushInterval(std::chrono::milliseconds(20));
+            stream.Open();
+            stream.Write(8);
+            bool waiting = stream.GetBufferedBytes() == 2;
+            std::this_thread::sleep_for(std::chrono::milliseconds(30));
+            bool idle = FileSize(textPath) == 0;
+            stream.Write(9);
+            bool flushed = stream.GetBufferedBytes() == 0 && FileSize(textPath) == 4;
+            stream.Close();
+            if (waiting && idle && flushed) {
+                std::cout << "  ✓ Test 13: OnInterval\n";
+                passed++;
+            } else {
+                std::cout << "  ⨯ Test 13 FAILED: OnInterval сбросил буфер не вовремя\n";
+            }
+        }
+
+        // Тест 14: запись и чтение обратно; пачка в память
+        {
+            std::remove(textPath);
+            {
+                WriteOnlyStream<double> stream(textPath);
+                stream.Open();
+                double values[] = {0.1, 1.0 / 3, -2.5e-7};
+                stream.Write(values, 3);
+            }
+            ReadOnlyStream<double> reader(textPath);
+            reader.Open();
+            bool same = reader.Read() == 0.1 && reader.Read() == 1.0 / 3 && reader.Read() == -2.5e-7;
+            std::vector<std::string> memory;
+            WriteOnlyStream<std::string> toMemory(&memory);
+            toMemory.Open();
+            std::string words[] = {"a", "b"};
+            size_t position = toMemory.Write(words, 2);
+            if (same && reader.IsEndOfStream() && position == 2 && memory.size() == 2 && memory[1] == "b") {
+                std::cout << "  ✓ Test 14: Запись без потери точности и пачка в память\n";
+                passed++;
+            } else {
+                std::cout << "  ⨯ Test 14 FAILED: записанное не совпадает с прочитанным\n";
+            }
+        }
+
+        // Тест 15: повторный Open закрывает файл и сбрасывает буфер
+        {
+            std::remove(textPath);
+            WriteOnlyStream<int> stream(textPath);
+            stream.Open();
+            stream.Write(5);
+            stream.Open();
+            bool flushed = FileSize(textPath) == 2 && stream.GetBufferedBytes() == 0;
+            stream.Write(6);
+            stream.Close();
+            if (flushed && FileSize(textPath) == 4) {
+                std::cout << "  ✓ Test 15: Повторный Open\n";
+                passed++;
+            } else {
+                std::cout << "  ⨯ Test 15 FAILED: повторный Open потерял буфер\n";
+            }
+        }
+
+        // Тест 16: ошибка записи в Close видна вызывающему, файл всё равно закрыт
+        {
+#ifdef __linux__
+            WriteOnlyStream<int> stream("/dev/full");
+            stream.SetFlushPolicy(FlushPolicy::Never);
+            stream.Open();
+            stream.Write(1);
+            bool thrown = false;
+            try {
+                stream.Close();
+            } catch (const StreamException&) {
+                thrown = true;
+            }
+            bool writeRejected = false;
+            try {
+                stream.Write(2);
+            } catch (const StreamNotOpenException&) {
+                writeRejected = true;
+            }
+            stream.Close();
+            bool ok = thrown && writeRejected && stream.GetBufferedBytes() == 0;
+#else
+            bool ok = true;
+#endif
+            if (ok) {
+                std::cout << "  ✓ Test 16: Ошибка записи в Close\n";
+                passed++;
+            } else {
+                std::cout << "  ⨯ Test 16 FAILED: ошибка записи потеряна\n";
+            }
+        }
+
+        // Тест 17: упреждающее чтение отдаёт всё по порядку, в том числе из открытого источника
+        {
+            std::remove(textPath);
+            {
+                WriteOnlyStream<int> stream(textPath);
+                stream.Open();
+                for (int i = 0; i < 1000; i++) {
+                    stream.Write(i);
+                }
+            }
+            ReadOnlyStream<int> source(textPath, 64);
+            PrefetchReadStream<int> prefetch(source, 7, 2);
+            prefetch.Open();
+            bool ordered = true;
+            int batch[10];
+            for (int i = 0; i < 1000 && ordered;) {
+                if (i % 100 == 0) {
+                    size_t got = prefetch.Read(batch, 10);
+                    for (size_t j = 0; j < got; j++) {
+                        ordered = ordered && batch[j] == i + static_cast<int>(j);
+                    }
+                    i += static_cast<int>(got);
+                } else {
+                    ordered = ordered && prefetch.Read() == i;
+                    i++;
+                }
+            }
+            bool complete = ordered && prefetch.IsEndOfStream() && prefetch.GetPosition() == 1000;
+            prefetch.Close();
+
+            source.Open();
+            bool skipped = source.Read() == 0 && source.Read() == 1;
+            prefetch.Open();
+            bool resumed = source.IsOpen() && prefetch.Read() == 2 && prefetch.Read(batch, 10) == 10 && batch[9] == 12;
+            prefetch.Close();
+            if (complete && skipped && resumed && !source.IsOpen()) {
+                std::cout << "  ✓ Test 17: Prefetch - порядок и уже открытый источник\n";
+                passed++;
+            } else {
+                std::cout << "  ⨯ Test 17 FAILED: упреждающее чтение исказило поток\n";
+            }
+        }
+
+        // Тест 18: Close, пока фоновый поток ждёт свободный буфер
+        {
+            ReadOnlyStream<int> source(textPath, 64);
+            PrefetchReadStream<int> prefetch(source, 4, 2);
+            prefetch.Open();
+            bool first = prefetch.Read() == 0;
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            prefetch.Close();
+            bool rejected = false;
+            try {
+                prefetch.Read();
+            } catch (const StreamNotOpenException&) {
+                rejected = true;
+            }
+            if (first && rejected && !source.IsOpen()) {
+                std::cout << "  ✓ Test 18: Prefetch - ранний Close\n";
+                passed++;
+            } else {
+                std::cout << "  ⨯ Test 18 FAILED: ранний Close не остановил чтение\n";
+            }
+        }
+
+        // Тест 19: ошибка разбора в фоне выбрасывается после прочитанных до неё порций
+        {
+            {
+                std::ofstream out(textPath, std::ios::binary);
+                out << "1 2 3 x 5";
+            }
+            ReadOnlyStream<int> source(textPath);
+            PrefetchReadStream<int> prefetch(source, 2);
+            prefetch.Open();
+            bool before = prefetch.Read() == 1 && prefetch.Read() == 2;
+            bool thrown = false;
+            try {
+                prefetch.Read();
+            } catch (const EndOfStreamException&) {
+            } catch (const StreamException&) {
+                thrown = true;
+            }
+            bool ended = prefetch.IsEndOfStream();
+            prefetch.Close();
+            if (before && thrown && ended) {
+                std::cout << "  ✓ Test 19: Prefetch - ошибка чтения\n";
+                passed++;
+            } else {
+                std::cout << "  ⨯ Test 19 FAILED: ошибка фонового чтения потеряна\n";
+            }
+        }
+
+        std::remove(textPath);
+        std::remove(path);
+        return passed;
+    }
 };
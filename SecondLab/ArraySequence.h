@@ -2,67 +2,271 @@
 #include "DynamicArray.h"
 #include "Sequence.h"
 #include <stdexcept>
+#include <atomic>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
 #include "Exeption.h"
 
+namespace array_detail {
+
+// N элементов внутри объекта; при N == 0 - пустая структура
+template <class T, int N>
+struct InlineStorage {
+    T items[N];
+    T* Data() { return items; }
+    const T* Data() const { return items; }
+};
+
 template <class T>
+struct InlineStorage<T, 0> {
+    T* Data() { return nullptr; }
+    const T* Data() const { return nullptr; }
+};
+
+}
+
+// Последовательность на непрерывном буфере.
+// До InlineCapacity элементов хранятся прямо в объекте без выделения памяти.
+// Встроенный буфер есть только у тривиальных T (числа, указатели, POD):
+// иначе каждый объект конструировал бы InlineCapacity лишних элементов.
+// Больший буфер лежит в куче и при копировании разделяется между копиями
+// (copy-on-write): настоящая копия делается при первой записи.
+template <class T, class CheckPolicy = CheckedPolicy>
 class ArraySequence : public Sequence<T> {
+public:
+    static const int InlineCapacity =
+        (std::is_trivially_copyable<T>::value && std::is_trivially_default_constructible<T>::value) ? 4 : 0;
+
 private:
-    DynamicArray<T>* items;
+    struct SharedArray {
+        DynamicArray<T, UncheckedPolicy> array;
+        std::atomic<int> refs;
+        explicit SharedArray(int size) : array(size), refs(1) {}
+        explicit SharedArray(DynamicArray<T, UncheckedPolicy>&& adopted) : array(std::move(adopted)), refs(1) {}
+    };
+
+    array_detail::InlineStorage<T, InlineCapacity> inlineItems;
+    SharedArray* shared;
     int count;
+    bool copyOnWrite;
+
+    T* Buffer() {
+        return shared ? shared->array.GetData() : inlineItems.Data();
+    }
+
+    const T* Buffer() const {
+        return shared ? shared->array.GetData() : inlineItems.Data();
+    }
+
+    int Capacity() const {
+        return shared ? shared->array.GetSize() : InlineCapacity;
+    }
+
+    static void Release(SharedArray* buffer) {
+        if (buffer && buffer->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete buffer;
+        }
+    }
+
+    // Перед записью: если буфер разделён с другими копиями, берём свой
+    void MakeUnique() {
+        if (shared && shared->refs.load(std::memory_order_acquire) > 1) {
+            SharedArray* own = new SharedArray(shared->array.GetSize());
+            const T* src = shared->array.GetData();
+            T* dst = own->array.GetData();
+            for (int i = 0; i < count; i++) {
+                dst[i] = src[i];
+            }
+            SEQ_STAT_ADD(ElementCopies, count);
+            Release(shared);
+            shared = own;
+        }
+    }
+
+    void Reallocate(int capacity) {
+        SharedArray* grown = new SharedArray(capacity);
+        T* dst = grown->array.GetData();
+        T* src = Buffer();
+        bool exclusive = !shared || shared->refs.load(std::memory_order_acquire) == 1;
+        for (int i = 0; i < count; i++) {
+            if (exclusive) {
+                dst[i] = std::move(src[i]);
+            } else {
+                dst[i] = src[i];
+            }
+        }
+        SEQ_STAT_ADD(Reallocations, 1);
+        if (exclusive) {
+            SEQ_STAT_ADD(ElementMoves, count);
+        } else {
+            SEQ_STAT_ADD(ElementCopies, count);
+        }
+        if (shared) {
+            Release(shared);
+        } else {
+            T* items = inlineItems.Data();
+            for (int i = 0; i < count; i++) {
+                items[i] = T();
+            }
+        }
+        shared = grown;
+    }
+
+    // Гарантирует место под capacity элементов и единоличное владение буфером
+    void Reserve(int capacity) {
+        if (capacity <= Capacity()) {
+            MakeUnique();
+            return;
+        }
+        int newCapacity = Capacity() * 2;
+        if (newCapacity < capacity) {
+            newCapacity = capacity;
+        }
+        Reallocate(newCapacity);
+    }
+
+    void CopyFrom(const ArraySequence& other) {
+        count = other.count;
+        if (other.shared && other.copyOnWrite) {
+            other.shared->refs.fetch_add(1, std::memory_order_relaxed);
+            shared = other.shared;
+            return;
+        }
+        shared = nullptr;
+        if (count > InlineCapacity) {
+            shared = new SharedArray(count);
+        }
+        const T* src = other.Buffer();
+        T* dst = Buffer();
+        for (int i = 0; i < count; i++) {
+            dst[i] = src[i];
+        }
+        SEQ_STAT_ADD(ElementCopies, count);
+    }
+
 public:
-    ArraySequence() {
-        items = new DynamicArray<T>(4);
-        count = 0;
+    ArraySequence() : shared(nullptr), count(0), copyOnWrite(true) {}
+
+    explicit ArraySequence(int length) : shared(nullptr), count(0), copyOnWrite(true) {
+        if (length < 0) {
+            throw MyException(ErrorType::NegativeSize, 0);
+        }
+        if (length > InlineCapacity) {
+            shared = new SharedArray(length);
+        }
+        count = length;
     }
 
-    ArraySequence(const T* arr, int length) {
+    ArraySequence(const T* arr, int length) : shared(nullptr), count(0), copyOnWrite(true) {
         if (length < 0) {
             throw MyException(ErrorType::NegativeSize, 0);
         }
-        items = new DynamicArray<T>(length);
+        if (length > InlineCapacity) {
+            shared = new SharedArray(length);
+        }
+        T* dst = Buffer();
         for (int i = 0; i < length; i++) {
-            items->Set(i, arr[i]);
+            dst[i] = arr[i];
         }
+        SEQ_STAT_ADD(ElementCopies, length);
         count = length;
     }
 
-    ArraySequence(const ArraySequence<T>& other) {
-        count = other.count;
-        items = new DynamicArray<T>(*other.items);
+    // Забирает готовый буфер без копирования; элементы [0, length) считаются заполненными
+    ArraySequence(DynamicArray<T, UncheckedPolicy>&& buffer, int length)
+        : shared(nullptr), count(0), copyOnWrite(true) {
+        if (length < 0) {
+            throw MyException(ErrorType::NegativeSize, 0);
+        }
+        if (length > buffer.GetSize()) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        shared = new SharedArray(std::move(buffer));
+        count = length;
+    }
+
+    ArraySequence(const ArraySequence& other) : copyOnWrite(other.copyOnWrite) {
+        CopyFrom(other);
+    }
+
+    ArraySequence& operator=(const ArraySequence& other) {
+        if (this != &other) {
+            SharedArray* old = shared;
+            CopyFrom(other);
+            Release(old);
+        }
+        return *this;
     }
 
     virtual ~ArraySequence() {
-        delete items;
+        Release(shared);
+    }
+
+    // Разрешает (по умолчанию) или запрещает копиям делить буфер с этой последовательностью
+    void SetCopyOnWrite(bool enabled) {
+        copyOnWrite = enabled;
     }
 
-    virtual T GetFirst() const override {
+    bool IsShared() const {
+        return shared && shared->refs.load(std::memory_order_acquire) > 1;
+    }
+
+    virtual T GetFirst() const final {
         if (count == 0) {
             throw MyException(ErrorType::OutOfRange, 2);
         }
-        return items->Get(0);
+        return Buffer()[0];
     }
 
-    virtual T GetLast() const override {
+    virtual T GetLast() const final {
         if (count == 0) {
             throw MyException(ErrorType::OutOfRange, 2);
         }
-        return items->Get(count - 1);
+        return Buffer()[count - 1];
     }
 
-    virtual T Get(int index) const override {
-        if (index < 0) {
-            throw MyException(ErrorType::OutOfRange, 0);
-        }
-        if (index >= count) {
-            throw MyException(ErrorType::OutOfRange, 1);
-        }
-        return items->Get(index);
+    virtual T Get(int index) const final {
+        CheckPolicy::CheckIndex(index, count);
+        return Buffer()[index];
+    }
+
+    const T& GetUnchecked(int index) const {
+        return Buffer()[index];
     }
 
-    virtual int GetLength() const override {
+    virtual int GetLength() const final {
         return count;
     }
 
+    // Непрерывный буфер элементов [0, GetLength()).
+    // Неконстантная версия - это запись: разделённый буфер сначала копируется.
+    // Указатель действителен до следующего изменения или копирования
+    // последовательности: копия снова разделит буфер, и запись по старому
+    // указателю будет видна в обеих.
+    T* GetData() {
+        MakeUnique();
+        return Buffer();
+    }
+
+    const T* GetData() const {
+        return Buffer();
+    }
+
+    // Обход без виртуальных вызовов: f(const T&) для каждого элемента по порядку
+    template <class F>
+    void ForEach(F f) const {
+        const T* data = Buffer();
+        for (int i = 0; i < count; i++) {
+            f(data[i]);
+        }
+    }
+
+    // Обход через Sequence<T>: один проход ForEach вместо n вызовов Get
+    virtual void VisitItems(void (*visit)(const T&, void*), void* context) const override {
+        ForEach([&](const T& item) { visit(item, context); });
+    }
+
     virtual Sequence<T>* GetSubsequence(int startIndex, int endIndex) const override {
         if (startIndex < 0) {
             throw MyException(ErrorType::OutOfRange, 0);
@@ -71,20 +275,19 @@ public:
             throw MyException(ErrorType::OutOfRange, 1);
         }
         int newLen = endIndex - startIndex + 1;
-        T* temp = new T[newLen];
-        for (int i = 0; i < newLen; i++) {
-            temp[i] = items->Get(startIndex + i);
-        }
-        ArraySequence<T>* result = new ArraySequence<T>(temp, newLen);
-        delete[] temp;
-        return result;
+        return new ArraySequence(Buffer() + startIndex, newLen);
     }
 
     virtual Sequence<T>* Append(const T& item) override {
-        if (count == items->Size()) {
-            items->Resize(items->Size() * 2);
+        if (count == Capacity()) {
+            T value = item;
+            Reserve(count + 1);
+            Buffer()[count] = std::move(value);
+        } else {
+            MakeUnique();
+            Buffer()[count] = item;
         }
-        items->Set(count, item);
+        SEQ_STAT_ADD(ElementCopies, 1);
         count++;
         return this;
     }
@@ -97,21 +300,23 @@ public:
         if (index < 0 || index >= count) {
             throw MyException(ErrorType::OutOfRange, 1);
         }
-        for (int i = index; i < count - 1; i++) {
-            items->Set(i, items->Get(i + 1));
-        }
+        MakeUnique();
+        T* data = Buffer();
+        std::move(data + index + 1, data + count, data + index);
+        SEQ_STAT_ADD(ElementMoves, count - index - 1);
+        data[count - 1] = T();
         count--;
         return this;
     }
 
     virtual Sequence<T>* Prepend(const T& item) override {
-        if (count == items->Size()) {
-            items->Resize(items->Size() * 2);
-        }
-        for (int i = count; i > 0; i--) {
-            items->Set(i, items->Get(i - 1));
-        }
-        items->Set(0, item);
+        T value = item;
+        Reserve(count + 1);
+        T* data = Buffer();
+        std::move_backward(data, data + count, data + count + 1);
+        data[0] = std::move(value);
+        SEQ_STAT_ADD(ElementMoves, count);
+        SEQ_STAT_ADD(ElementCopies, 1);
         count++;
         return this;
     }
@@ -123,19 +328,77 @@ public:
         if (index >= count) {
             throw MyException(ErrorType::OutOfRange, 1);
         }
-        if (count == items->Size()) {
-            items->Resize(items->Size() * 2);
+        T value = item;
+        Reserve(count + 1);
+        T* data = Buffer();
+        std::move_backward(data + index, data + count, data + count + 1);
+        data[index] = std::move(value);
+        SEQ_STAT_ADD(ElementMoves, count - index);
+        SEQ_STAT_ADD(ElementCopies, 1);
+        count++;
+        return this;
+    }
+
+    virtual Sequence<T>* AppendRange(const T* items, int n) override {
+        return ArraySequence::InsertRange(items, n, count);
+    }
+
+    // Одно резервирование и один сдвиг хвоста на n позиций
+    virtual Sequence<T>* InsertRange(const T* items, int n, int index) override {
+        if (n < 0) {
+            throw MyException(ErrorType::NegativeSize, 0);
+        }
+        if (index < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
         }
-        for (int i = count; i > index; i--) {
-            items->Set(i, items->Get(i - 1));
+        if (index > count) {
+            throw MyException(ErrorType::OutOfRange, 1);
         }
-        items->Set(index, item);
-        count++;
+        if (n == 0) {
+            return this;
+        }
+        const T* current = Buffer();
+        if (items >= current && items < current + count) {
+            // Источник внутри собственного буфера: он может переехать при Reserve
+            ArraySequence copy(items, n);
+            copy.SetCopyOnWrite(false);
+            return ArraySequence::InsertRange(copy.Buffer(), n, index);
+        }
+        Reserve(count + n);
+        T* data = Buffer();
+        std::move_backward(data + index, data + count, data + count + n);
+        std::copy(items, items + n, data + index);
+        SEQ_STAT_ADD(ElementMoves, count - index);
+        SEQ_STAT_ADD(ElementCopies, n);
+        count += n;
+        return this;
+    }
+
+    virtual Sequence<T>* RemoveRange(int startIndex, int endIndex) override {
+        if (startIndex < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (endIndex < 0 || startIndex > endIndex || endIndex >= count) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        MakeUnique();
+        T* data = Buffer();
+        int removed = endIndex - startIndex + 1;
+        std::move(data + endIndex + 1, data + count, data + startIndex);
+        SEQ_STAT_ADD(ElementMoves, count - endIndex - 1);
+        std::fill(data + count - removed, data + count, T());
+        count -= removed;
         return this;
     }
 
     virtual Sequence<T>* Concat(const Sequence<T>* seq) const override {
-        ArraySequence<T>* newSeq = new ArraySequence<T>(*this);
+        ArraySequence* newSeq = new ArraySequence();
+        newSeq->Reserve(count + seq->GetLength());
+        newSeq->AppendRange(Buffer(), count);
+        if (const ArraySequence* other = dynamic_cast<const ArraySequence*>(seq)) {
+            newSeq->AppendRange(other->Buffer(), other->count);
+            return newSeq;
+        }
         for (int i = 0; i < seq->GetLength(); i++) {
             newSeq->Append(seq->Get(i));
         }
@@ -144,14 +407,20 @@ public:
 
     void reverse() {
         int n = count;
+        MakeUnique();
+        T* data = Buffer();
         for (int i = 0; i < n / 2; ++i) {
-            T tmp = items->Get(i);
-            items->Set(i, items->Get(n - 1 - i));
-            items->Set(n - 1 - i, tmp);
+            std::swap(data[i], data[n - 1 - i]);
         }
     }
 
     virtual Sequence<T>* Clone() const override {
-        return new ArraySequence<T>(*this);
+        return new ArraySequence(*this);
     }
-};
\ No newline at end of file
+};
+
+// Для static_map/static_where/static_reduce из StaticFunctions.h
+template <class T, class P, class F>
+void static_for_each(const ArraySequence<T, P>& seq, F f) {
+    seq.ForEach(f);
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include "Exeption.h"
+
+// Политики проверки индексов для DynamicArray, ArraySequence и LinkedList.
+// Одно беззнаковое сравнение покрывает и index < 0, и index >= size;
+// исключение строится вне горячего пути (ThrowIndexError в Error.cpp).
+
+// Проверка всегда (по умолчанию для публичного API)
+struct CheckedPolicy {
+    static void CheckIndex(int index, int size) {
+        if (static_cast<unsigned>(index) >= static_cast<unsigned>(size)) {
+            ThrowIndexError(index);
+        }
+    }
+};
+
+// Проверка только в отладочной сборке (без NDEBUG)
+struct DebugCheckedPolicy {
+    static void CheckIndex(int index, int size) {
+#ifndef NDEBUG
+        CheckedPolicy::CheckIndex(index, size);
+#else
+        (void)index;
+        (void)size;
+#endif
+    }
+};
+
+// Без проверок: ответственность за индекс на вызывающем
+struct UncheckedPolicy {
+    static void CheckIndex(int, int) {}
+};
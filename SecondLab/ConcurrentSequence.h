@@ -0,0 +1,358 @@
+#pragma once
+#include "Sequence.h"
+#include "ArraySequence.h"
+#include "DynamicArray.h"
+#include "Exeption.h"
+#include <atomic>
+#include <climits>
+#include <thread>
+#include <utility>
+
+// Последовательность только для добавления из многих потоков без блокировок.
+// Память - сегменты размером B, 2B, 4B, ... (B = firstSegment): сегмент
+// никогда не переезжает, поэтому опубликованный элемент можно читать,
+// пока другие потоки добавляют новые.
+//
+// Append резервирует позицию атомарным fetch_add, записывает элемент
+// и публикует его флагом готовности (release). GetLength() - число
+// зарезервированных позиций; Get ждёт публикации элемента, TryGet - нет.
+// Вставка в середину и удаление не поддерживаются (SequenceError 1).
+//
+// Если писатель не смог записать зарезервированный элемент (исключение
+// при копировании T или нехватка памяти), позиция помечается сбойной,
+// и Get/TryGet/Freeze для неё бросают SequenceError 1 вместо вечного ожидания.
+// Если не удалось даже выделить сегмент, сбойными считаются все ещё
+// не опубликованные позиции.
+//
+// Freeze вызывается, когда писатели закончили, и превращает содержимое
+// в обычный ArraySequence: если всё поместилось в первый сегмент, его буфер
+// передаётся без копирования, иначе элементы один раз перемещаются.
+template <class T>
+class ConcurrentSequence : public Sequence<T> {
+public:
+    static const int MaxSegments = 32;
+
+private:
+    // Состояния позиции в ready
+    static const unsigned char Pending = 0;
+    static const unsigned char Ready = 1;
+    static const unsigned char Failed = 2;
+
+    struct Segment {
+        DynamicArray<T, UncheckedPolicy> items;
+        std::atomic<unsigned char>* ready;
+        explicit Segment(int size) : items(size), ready(new std::atomic<unsigned char>[size]) {
+            for (int i = 0; i < size; i++) {
+                ready[i].store(Pending, std::memory_order_relaxed);
+            }
+        }
+        ~Segment() {
+            delete[] ready;
+        }
+    };
+
+    std::atomic<Segment*> segments[MaxSegments];
+    std::atomic<int> reserved;
+    std::atomic<bool> lostSegment;  // сегмент сбойной позиции не удалось создать
+    int firstSegment;
+
+    long long SegmentStart(int k) const {
+        return static_cast<long long>(firstSegment) * ((1LL << k) - 1);
+    }
+
+    // Последний сегмент обрезан по INT_MAX: индексы позиций - int
+    int SegmentSize(int k) const {
+        long long size = static_cast<long long>(firstSegment) << k;
+        long long room = static_cast<long long>(INT_MAX) - SegmentStart(k);
+        return static_cast<int>(size < room ? size : room);
+    }
+
+    // Позиция index лежит в сегменте k по смещению offset
+    void Locate(int index, int& k, int& offset) const {
+        unsigned q = static_cast<unsigned>(index / firstSegment) + 1;
+        k = 31 - __builtin_clz(q);
+        offset = static_cast<int>(index - SegmentStart(k));
+    }
+
+    // Сегмент создаёт первый дошедший до него поток; проигравший CAS удаляет свой
+    Segment* Acquire(int k) {
+        Segment* segment = segments[k].load(std::memory_order_acquire);
+        if (segment) {
+            return segment;
+        }
+        Segment* fresh = new Segment(SegmentSize(k));
+        if (segments[k].compare_exchange_strong(segment, fresh, std::memory_order_acq_rel,
+                                                std::memory_order_acquire)) {
+            return fresh;
+        }
+        delete fresh;
+        return segment;
+    }
+
+    void Write(int index, const T& item) {
+        int k, offset;
+        Locate(index, k, offset);
+        Segment* segment = Acquire(k);
+        segment->items.SetUnchecked(offset, item);
+        segment->ready[offset].store(Ready, std::memory_order_release);
+    }
+
+    // Зарезервированная позиция не будет записана
+    void MarkFailed(int index) noexcept {
+        int k, offset;
+        Locate(index, k, offset);
+        Segment* segment = segments[k].load(std::memory_order_acquire);
+        if (segment) {
+            segment->ready[offset].store(Failed, std::memory_order_release);
+        } else {
+            lostSegment.store(true, std::memory_order_release);
+        }
+    }
+
+    // После неудачного создания сегмента неизвестно, какие позиции потеряны,
+    // поэтому все неопубликованные считаются сбойными
+    unsigned char State(int index, const T*& item) const {
+        int k, offset;
+        Locate(index, k, offset);
+        Segment* segment = segments[k].load(std::memory_order_acquire);
+        unsigned char state = segment ? segment->ready[offset].load(std::memory_order_acquire) : Pending;
+        if (state == Ready) {
+            item = &segment->items.GetUnchecked(offset);
+        } else if (state == Pending && lostSegment.load(std::memory_order_acquire)) {
+            state = Failed;
+        }
+        return state;
+    }
+
+    // nullptr, если элемент ещё не опубликован; сбойная позиция бросает исключение
+    const T* Published(int index) const {
+        const T* item = nullptr;
+        if (State(index, item) == Failed) {
+            Unsupported();
+        }
+        return item;
+    }
+
+    const T& WaitFor(int index) const {
+        const T* item = Published(index);
+        while (!item) {
+            std::this_thread::yield();
+            item = Published(index);
+        }
+        return *item;
+    }
+
+    void Reset() {
+        for (int k = 0; k < MaxSegments; k++) {
+            delete segments[k].exchange(nullptr, std::memory_order_acq_rel);
+        }
+        reserved.store(0, std::memory_order_release);
+        lostSegment.store(false, std::memory_order_release);
+    }
+
+    static void Unsupported() {
+        throw MyException(ErrorType::SequenceError, 1);
+    }
+
+public:
+    explicit ConcurrentSequence(int firstSegmentSize = 1024)
+        : reserved(0), lostSegment(false), firstSegment(firstSegmentSize) {
+        if (firstSegmentSize <= 0) {
+            throw MyException(ErrorType::NegativeSize, 0);
+        }
+        for (int k = 0; k < MaxSegments; k++) {
+            segments[k].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ConcurrentSequence(const ConcurrentSequence&) = delete;
+    ConcurrentSequence& operator=(const ConcurrentSequence&) = delete;
+
+    virtual ~ConcurrentSequence() {
+        Reset();
+    }
+
+    virtual Sequence<T>* Append(const T& item) override {
+        int index = reserved.fetch_add(1, std::memory_order_relaxed);
+        try {
+            Write(index, item);
+        } catch (...) {
+            MarkFailed(index);
+            throw;
+        }
+        return this;
+    }
+
+    // Одна резервация на весь диапазон: элементы лягут подряд
+    virtual Sequence<T>* AppendRange(const T* items, int count) override {
+        if (count < 0) {
+            throw MyException(ErrorType::NegativeSize, 0);
+        }
+        int start = reserved.fetch_add(count, std::memory_order_relaxed);
+        int i = 0;
+        try {
+            for (; i < count; i++) {
+                Write(start + i, items[i]);
+            }
+        } catch (...) {
+            for (; i < count; i++) {
+                MarkFailed(start + i);
+            }
+            throw;
+        }
+        return this;
+    }
+
+    bool IsPublished(int index) const {
+        const T* item = nullptr;
+        return index >= 0 && index < GetLength() && State(index, item) == Ready;
+    }
+
+    // Не ждёт: false, если элемент ещё пишется; сбойная позиция бросает исключение
+    bool TryGet(int index, T& out) const {
+        if (index < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (index >= GetLength()) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        const T* item = Published(index);
+        if (!item) {
+            return false;
+        }
+        out = *item;
+        return true;
+    }
+
+    virtual T Get(int index) const override {
+        if (index < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (index >= GetLength()) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        return WaitFor(index);
+    }
+
+    virtual T GetFirst() const override {
+        if (GetLength() == 0) {
+            throw MyException(ErrorType::OutOfRange, 2);
+        }
+        return WaitFor(0);
+    }
+
+    virtual T GetLast() const override {
+        int length = GetLength();
+        if (length == 0) {
+            throw MyException(ErrorType::OutOfRange, 2);
+        }
+        return WaitFor(length - 1);
+    }
+
+    virtual int GetLength() const override {
+        return reserved.load(std::memory_order_acquire);
+    }
+
+    // Обходит позиции, зарезервированные к началу обхода; добавленные позже не видны
+    virtual void VisitItems(void (*visit)(const T&, void*), void* context) const override {
+        int length = GetLength();
+        for (int i = 0; i < length; i++) {
+            visit(WaitFor(i), context);
+        }
+    }
+
+    // Забирает содержимое в ArraySequence; сама последовательность становится пустой.
+    // Вызывать, когда добавления закончились
+    ArraySequence<T>* Freeze() {
+        int length = GetLength();
+        for (int i = 0; i < length; i++) {
+            WaitFor(i);
+        }
+        ArraySequence<T>* result;
+        Segment* first = segments[0].load(std::memory_order_acquire);
+        if (length <= firstSegment) {
+            result = first ? new ArraySequence<T>(std::move(first->items), length)
+                           : new ArraySequence<T>();
+        } else {
+            result = new ArraySequence<T>(length);
+            T* dst = result->GetData();
+            for (int k = 0, done = 0; done < length; k++) {
+                Segment* segment = segments[k].load(std::memory_order_acquire);
+                int take = SegmentSize(k) < length - done ? SegmentSize(k) : length - done;
+                T* src = segment->items.GetData();
+                for (int i = 0; i < take; i++) {
+                    dst[done + i] = std::move(src[i]);
+                }
+                done += take;
+            }
+        }
+        Reset();
+        return result;
+    }
+
+    virtual Sequence<T>* GetSubsequence(int startIndex, int endIndex) const override {
+        if (startIndex < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (endIndex < 0 || startIndex > endIndex || endIndex >= GetLength()) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        ArraySequence<T>* result = new ArraySequence<T>(endIndex - startIndex + 1);
+        T* dst = result->GetData();
+        for (int i = startIndex; i <= endIndex; i++) {
+            dst[i - startIndex] = WaitFor(i);
+        }
+        return result;
+    }
+
+    virtual Sequence<T>* Concat(const Sequence<T>* seq) const override {
+        int length = GetLength();
+        ArraySequence<T>* result = new ArraySequence<T>();
+        for (int i = 0; i < length; i++) {
+            result->Append(WaitFor(i));
+        }
+        for (int i = 0; i < seq->GetLength(); i++) {
+            result->Append(seq->Get(i));
+        }
+        return result;
+    }
+
+    virtual Sequence<T>* Prepend(const T&) override {
+        Unsupported();
+        return this;
+    }
+
+    virtual Sequence<T>* InsertAt(const T&, int) override {
+        Unsupported();
+        return this;
+    }
+
+    virtual Sequence<T>* RemoveAt(int) override {
+        Unsupported();
+        return this;
+    }
+
+    virtual Sequence<T>* InsertRange(const T*, int, int) override {
+        Unsupported();
+        return this;
+    }
+
+    virtual Sequence<T>* RemoveRange(int, int) override {
+        Unsupported();
+        return this;
+    }
+
+    virtual const char* TypeName() const override {
+        return "ConcurrentSequence";
+    }
+
+    // Снимок уже зарезервированных элементов в новую ConcurrentSequence
+    virtual Sequence<T>* Clone() const override {
+        ConcurrentSequence<T>* copy = new ConcurrentSequence<T>(firstSegment);
+        int length = GetLength();
+        for (int i = 0; i < length; i++) {
+            copy->Append(WaitFor(i));
+        }
+        return copy;
+    }
+};
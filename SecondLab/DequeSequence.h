@@ -0,0 +1,346 @@
+#pragma once
+#include "DynamicArray.h"
+#include "Sequence.h"
+#include "Exeption.h"
+#include <utility>
+
+// Последовательность на кольцевом буфере: Append/Prepend и удаление
+// с обоих концов за амортизированное O(1), Get за O(1).
+// InsertAt/RemoveAt сдвигают элементы в сторону ближайшего конца.
+template <class T>
+class DequeSequence : public Sequence<T> {
+private:
+    DynamicArray<T>* items;
+    int head;
+    int count;
+
+    // Ёмкость всегда степень двойки
+    int Mask() const {
+        return items->GetSize() - 1;
+    }
+
+    int Physical(int index) const {
+        return (head + index) & Mask();
+    }
+
+    T& At(int index) {
+        return items->GetData()[Physical(index)];
+    }
+
+    const T& At(int index) const {
+        return items->GetData()[Physical(index)];
+    }
+
+    void Grow(int minCapacity = 0) {
+        int capacity = items->GetSize() * 2;
+        while (capacity < minCapacity) {
+            capacity *= 2;
+        }
+        DynamicArray<T>* grown = new DynamicArray<T>(capacity);
+        T* dst = grown->GetData();
+        for (int i = 0; i < count; i++) {
+            dst[i] = std::move(At(i));
+        }
+        SEQ_STAT_ADD(Reallocations, 1);
+        SEQ_STAT_ADD(ElementMoves, count);
+        delete items;
+        items = grown;
+        head = 0;
+    }
+
+    void CheckIndex(int index) const {
+        if (index < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (index >= count) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+    }
+
+    static int CapacityFor(int length) {
+        int capacity = 4;
+        while (capacity < length) {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+public:
+    DequeSequence() {
+        items = new DynamicArray<T>(4);
+        head = 0;
+        count = 0;
+    }
+
+    DequeSequence(const T* arr, int length) {
+        if (length < 0) {
+            throw MyException(ErrorType::NegativeSize, 0);
+        }
+        items = new DynamicArray<T>(CapacityFor(length));
+        T* dst = items->GetData();
+        for (int i = 0; i < length; i++) {
+            dst[i] = arr[i];
+        }
+        head = 0;
+        count = length;
+    }
+
+    DequeSequence(const DequeSequence<T>& other) {
+        items = new DynamicArray<T>(CapacityFor(other.count));
+        T* dst = items->GetData();
+        for (int i = 0; i < other.count; i++) {
+            dst[i] = other.At(i);
+        }
+        head = 0;
+        count = other.count;
+    }
+
+    DequeSequence<T>& operator=(const DequeSequence<T>& other) {
+        if (this != &other) {
+            DequeSequence<T> copy(other);
+            std::swap(items, copy.items);
+            std::swap(head, copy.head);
+            std::swap(count, copy.count);
+        }
+        return *this;
+    }
+
+    virtual ~DequeSequence() {
+        delete items;
+    }
+
+    virtual T GetFirst() const override {
+        if (count == 0) {
+            throw MyException(ErrorType::OutOfRange, 2);
+        }
+        return At(0);
+    }
+
+    virtual T GetLast() const override {
+        if (count == 0) {
+            throw MyException(ErrorType::OutOfRange, 2);
+        }
+        return At(count - 1);
+    }
+
+    virtual T Get(int index) const override {
+        CheckIndex(index);
+        return At(index);
+    }
+
+    void Set(int index, const T& value) {
+        CheckIndex(index);
+        At(index) = value;
+    }
+
+    virtual int GetLength() const override {
+        return count;
+    }
+
+    // Два непрерывных куска кольца: от head до конца буфера и начало буфера
+    template <class F>
+    void ForEach(F f) const {
+        const T* data = items->GetData();
+        int first = items->GetSize() - head < count ? items->GetSize() - head : count;
+        for (int i = 0; i < first; i++) {
+            f(data[head + i]);
+        }
+        for (int i = 0; i < count - first; i++) {
+            f(data[i]);
+        }
+    }
+
+    // Обход через Sequence<T>: один проход ForEach вместо n вызовов Get
+    virtual void VisitItems(void (*visit)(const T&, void*), void* context) const override {
+        ForEach([&](const T& item) { visit(item, context); });
+    }
+
+    int GetCapacity() const {
+        return items->GetSize();
+    }
+
+    virtual Sequence<T>* GetSubsequence(int startIndex, int endIndex) const override {
+        if (startIndex < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (endIndex < 0 || startIndex > endIndex || endIndex >= count) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        DequeSequence<T>* result = new DequeSequence<T>();
+        for (int i = startIndex; i <= endIndex; i++) {
+            result->Append(At(i));
+        }
+        return result;
+    }
+
+    virtual Sequence<T>* Append(const T& item) override {
+        if (count == items->GetSize()) {
+            Grow();
+        }
+        At(count) = item;
+        count++;
+        return this;
+    }
+
+    virtual Sequence<T>* Prepend(const T& item) override {
+        if (count == items->GetSize()) {
+            Grow();
+        }
+        head = (head - 1) & Mask();
+        At(0) = item;
+        count++;
+        return this;
+    }
+
+    virtual Sequence<T>* InsertAt(const T& item, int index) override {
+        CheckIndex(index);
+        if (count == items->GetSize()) {
+            Grow();
+        }
+        if (index < count - index) {
+            head = (head - 1) & Mask();
+            for (int i = 0; i < index; i++) {
+                At(i) = std::move(At(i + 1));
+            }
+        } else {
+            for (int i = count; i > index; i--) {
+                At(i) = std::move(At(i - 1));
+            }
+        }
+        At(index) = item;
+        count++;
+        return this;
+    }
+
+    virtual Sequence<T>* RemoveAt(int index) override {
+        if (index < 0 || index >= count) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        if (index < count - 1 - index) {
+            for (int i = index; i > 0; i--) {
+                At(i) = std::move(At(i - 1));
+            }
+            At(0) = T();
+            head = (head + 1) & Mask();
+        } else {
+            for (int i = index; i < count - 1; i++) {
+                At(i) = std::move(At(i + 1));
+            }
+            At(count - 1) = T();
+        }
+        count--;
+        return this;
+    }
+
+    T RemoveFirst() {
+        if (count == 0) {
+            throw MyException(ErrorType::OutOfRange, 3);
+        }
+        T value = std::move(At(0));
+        At(0) = T();
+        head = (head + 1) & Mask();
+        count--;
+        return value;
+    }
+
+    T RemoveLast() {
+        if (count == 0) {
+            throw MyException(ErrorType::OutOfRange, 3);
+        }
+        T value = std::move(At(count - 1));
+        At(count - 1) = T();
+        count--;
+        return value;
+    }
+
+    virtual Sequence<T>* AppendRange(const T* arr, int n) override {
+        return InsertRange(arr, n, count);
+    }
+
+    // Освобождает место сдвигом ближней к index части на n позиций
+    virtual Sequence<T>* InsertRange(const T* arr, int n, int index) override {
+        if (n < 0) {
+            throw MyException(ErrorType::NegativeSize, 0);
+        }
+        if (index < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (index > count) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        if (count + n > items->GetSize()) {
+            Grow(count + n);
+        }
+        if (index < count - index) {
+            head = (head - n) & Mask();
+            for (int i = 0; i < index; i++) {
+                At(i) = std::move(At(i + n));
+            }
+        } else {
+            for (int i = count - 1; i >= index; i--) {
+                At(i + n) = std::move(At(i));
+            }
+        }
+        for (int i = 0; i < n; i++) {
+            At(index + i) = arr[i];
+        }
+        count += n;
+        return this;
+    }
+
+    virtual Sequence<T>* RemoveRange(int startIndex, int endIndex) override {
+        if (startIndex < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (endIndex < 0 || startIndex > endIndex || endIndex >= count) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        int removed = endIndex - startIndex + 1;
+        if (startIndex < count - 1 - endIndex) {
+            for (int i = startIndex - 1; i >= 0; i--) {
+                At(i + removed) = std::move(At(i));
+            }
+            for (int i = 0; i < removed; i++) {
+                At(i) = T();
+            }
+            head = (head + removed) & Mask();
+        } else {
+            for (int i = endIndex + 1; i < count; i++) {
+                At(i - removed) = std::move(At(i));
+            }
+            for (int i = count - removed; i < count; i++) {
+                At(i) = T();
+            }
+        }
+        count -= removed;
+        return this;
+    }
+
+    virtual Sequence<T>* Concat(const Sequence<T>* seq) const override {
+        DequeSequence<T>* result = new DequeSequence<T>(*this);
+        for (int i = 0; i < seq->GetLength(); i++) {
+            result->Append(seq->Get(i));
+        }
+        return result;
+    }
+
+    void reverse() {
+        for (int i = 0; i < count / 2; ++i) {
+            std::swap(At(i), At(count - 1 - i));
+        }
+    }
+
+    virtual const char* TypeName() const override {
+        return "DequeSequence";
+    }
+
+    virtual Sequence<T>* Clone() const override {
+        return new DequeSequence<T>(*this);
+    }
+};
+
+// Для static_map/static_where/static_reduce из StaticFunctions.h
+template <class T, class F>
+void static_for_each(const DequeSequence<T>& seq, F f) {
+    seq.ForEach(f);
+}
@@ -1,23 +1,39 @@
 #pragma once
 #include <stdexcept>
 #include "Exeption.h"
+#include "CheckPolicy.h"
+#include "SequenceStats.h"
 
-template <class T>
+template <class T, class CheckPolicy = CheckedPolicy>
 class DynamicArray {
 private:
     T* data;
     int size;
 
+    // Все выделения буфера идут через эти две функции (для SequenceStats)
+    static T* Allocate(int count) {
+        SEQ_STAT_ALLOC(static_cast<long long>(count) * sizeof(T));
+        return new T[count];
+    }
+
+    static void Free(T* buffer) {
+        if (buffer) {
+            SEQ_STAT_ADD(Deallocations, 1);
+        }
+        delete[] buffer;
+    }
+
 public:
     DynamicArray(const T* items, int count) {
         if (count < 0) {
             throw MyException(ErrorType::NegativeSize, 0);
         }
         size = count;
-        data = new T[size];
+        data = Allocate(size);
         for (int i = 0; i < size; i++) {
             data[i] = items[i];
         }
+        SEQ_STAT_ADD(ElementCopies, size);
     }
 
     DynamicArray(int size) {
@@ -25,46 +41,60 @@ public:
             throw MyException(ErrorType::NegativeSize, 0);
         }
         this->size = size;
-        data = new T[size];
+        data = Allocate(size);
         for (int i = 0; i < size; i++) {
             data[i] = T();
         }
     }
 
-    DynamicArray(const DynamicArray<T>& other) {
+    DynamicArray(const DynamicArray& other) {
         size = other.size;
-        data = new T[size];
+        data = Allocate(size);
         for (int i = 0; i < size; i++) {
             data[i] = other.data[i];
         }
+        SEQ_STAT_ADD(ElementCopies, size);
+    }
+
+    // Забирает буфер other без копирования; other остаётся пустым
+    DynamicArray(DynamicArray&& other) noexcept : data(other.data), size(other.size) {
+        other.data = nullptr;
+        other.size = 0;
     }
 
     ~DynamicArray() {
-        delete[] data;
+        Free(data);
     }
 
     int GetSize() const {
         return size;
     }
 
+    T* GetData() {
+        return data;
+    }
+
+    const T* GetData() const {
+        return data;
+    }
+
 
     T Get(int index) const {
-        if (index < 0) {
-            throw MyException(ErrorType::OutOfRange, 0); // code=0 => "index < 0?"
-        }
-        if (index >= size) {
-            throw MyException(ErrorType::OutOfRange, 1); // code=1 => "index >= size"
-        }
+        CheckPolicy::CheckIndex(index, size);
         return data[index];
     }
 
     void Set(int index, const T& value) {
-        if (index < 0) {
-            throw MyException(ErrorType::OutOfRange, 0);
-        }
-        if (index >= size) {
-            throw MyException(ErrorType::OutOfRange, 1);
-        }
+        CheckPolicy::CheckIndex(index, size);
+        data[index] = value;
+    }
+
+    // Доступ без проверки индекса для внутренних циклов библиотеки
+    const T& GetUnchecked(int index) const {
+        return data[index];
+    }
+
+    void SetUnchecked(int index, const T& value) {
         data[index] = value;
     }
 
@@ -72,7 +102,7 @@ public:
         if (newSize < 0) {
             throw MyException(ErrorType::OutOfRange, 0);
         }
-        T* newData = new T[newSize];
+        T* newData = Allocate(newSize);
         int minSize = (newSize < size) ? newSize : size;
         for (int i = 0; i < minSize; i++) {
             newData[i] = data[i];
@@ -80,39 +110,32 @@ public:
         for (int i = minSize; i < newSize; i++) {
             newData[i] = T();
         }
-        delete[] data;
+        SEQ_STAT_ADD(Reallocations, 1);
+        SEQ_STAT_ADD(ElementCopies, minSize);
+        Free(data);
         data = newData;
         size = newSize;
     }
 
-    DynamicArray<T>& operator=(const DynamicArray<T>& other) {
+    DynamicArray& operator=(const DynamicArray& other) {
         if (this != &other) {
-            delete[] data;
+            Free(data);
             size = other.size;
-            data = new T[size];
+            data = Allocate(size);
             for (int i = 0; i < size; i++) {
                 data[i] = other.data[i];
             }
+            SEQ_STAT_ADD(ElementCopies, size);
         }
         return *this;
     }
 
     T& operator[](int index) {
-        if (index < 0) {
-            throw MyException(ErrorType::OutOfRange, 0);
-        }
-        if (index >= size) {
-            throw MyException(ErrorType::OutOfRange, 1);
-        }
+        CheckPolicy::CheckIndex(index, size);
         return data[index];
     }
     const T& operator[](int index) const {
-        if (index < 0) {
-            throw MyException(ErrorType::OutOfRange, 0);
-        }
-        if (index >= size) {
-            throw MyException(ErrorType::OutOfRange, 1);
-        }
+        CheckPolicy::CheckIndex(index, size);
         return data[index];
     }
 };
\ No newline at end of file
@@ -16,6 +16,12 @@ std::vector<ErrorInfo> g_ErrorTable = {
     {static_cast<int>(ErrorType::SequenceError), 0, "Sequence type mismatch"}, // TypeMismatch
     {static_cast<int>(ErrorType::SequenceError), 1, "Invalid sequence operation"}, // InvalidOperation
     
+    // Ошибки файлов
+    {static_cast<int>(ErrorType::FileError), 0, "Cannot open file?"},
+    {static_cast<int>(ErrorType::FileError), 1, "File size does not fit element type?"},
+    {static_cast<int>(ErrorType::FileError), 2, "Cannot map file?"},
+    {static_cast<int>(ErrorType::FileError), 3, "Cannot write file?"},
+
     // UI ошибки
     {static_cast<int>(ErrorType::InvalidArg), 0, "Menu input not an integer?"},
     {static_cast<int>(ErrorType::InvalidArg), 1, "Array input was not integer?"},
@@ -43,6 +49,10 @@ MyException::MyException(ErrorType t, int sc) : type(t), subCode(sc) {
     message = "Unknown error";
 }
 
+void ThrowIndexError(int index) {
+    throw MyException(ErrorType::OutOfRange, index < 0 ? 0 : 1);
+}
+
 std::string getErrorMessage(ErrorType type, int subCode) {
     for (auto &err : g_ErrorTable) {
         if (static_cast<int>(type) == err.code && 
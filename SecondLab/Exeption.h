@@ -8,7 +8,8 @@ enum class ErrorType {
     InvalidArg,
     NegativeSize,
     OptionError,
-    SequenceError
+    SequenceError,
+    FileError
 };
 
 class MyException : public std::exception {
@@ -25,4 +26,8 @@ public:
     const char* what() const noexcept override {
         return message.c_str();
     }
-};
\ No newline at end of file
+};
+
+// Бросает OutOfRange с подкодом 0 (index < 0) или 1 (index >= size).
+// Вынесено из шаблонов, чтобы проверки индексов оставались короткими.
+[[noreturn]] void ThrowIndexError(int index);
@@ -2,9 +2,13 @@
 #include "Sequence.h"
 #include "ArraySequence.h"
 #include "ListSequence.h"
+#include "SequenceView.h"
+#include "ZippedSequence.h"
 #include "Option.h"
 #include "MonadPair.h"
 #include "MonadTuple.h"
+#include "SimdKernels.h"
+#include "StaticFunctions.h"
 #include <tuple>
 #include <vector>
 #include <algorithm>
@@ -22,37 +26,70 @@ size_t min_length(const Seqs*... seqs) {
 // Шаблонная функция для zip произвольного количества последовательностей
 template <typename... Ts>
 Sequence<MonadTuple<Ts...>>* zip_as_tuple(const Sequence<Ts>*... seqs) {
-    const size_t minLen = min_length(seqs...);
-    auto* result = new ArraySequence<MonadTuple<Ts...>>();
+    const int minLen = static_cast<int>(min_length(seqs...));
+    auto* result = new ArraySequence<MonadTuple<Ts...>>(minLen);
+    MonadTuple<Ts...>* rows = result->GetData();
     
-    for (size_t i = 0; i < minLen; i++) {
-        result->Append(MonadTuple<Ts...>(seqs->Get(i)...));
+    for (int i = 0; i < minLen; i++) {
+        rows[i] = MonadTuple<Ts...>(seqs->Get(i)...);
     }
     return result;
 }
 
-// Шаблонная функция для unzip кортежа
+// Колоночный zip: каждая последовательность копируется в свой столбец
+template <typename... Ts>
+ZippedSequence<Ts...>* zip_columns(const Sequence<Ts>*... seqs) {
+    return new ZippedSequence<Ts...>(seqs...);
+}
+
+template <typename... Ts, size_t... Is>
+void unzip_row(std::tuple<Sequence<Ts>*...>& sequences, const MonadTuple<Ts...>& row,
+               std::index_sequence<Is...>) {
+    (std::get<Is>(sequences)->Append(row.template get<Is>()), ...);
+}
+
+template <typename... Ts, size_t... Is>
+std::tuple<Sequence<Ts>*...> copy_columns(const ZippedSequence<Ts...>* zipped, std::index_sequence<Is...>) {
+    return std::tuple<Sequence<Ts>*...>(zipped->template Column<Is>().Clone()...);
+}
+
+// Шаблонная функция для unzip кортежа.
+// Для ZippedSequence столбцы копируются целиком; забрать их без копирования
+// можно через ZippedSequence::Unzip()
 template <typename... Ts>
 std::tuple<Sequence<Ts>*...> unzip_tuple(const Sequence<MonadTuple<Ts...>>* seq) {
-    std::tuple<Sequence<Ts>*...> sequences = std::make_tuple(new ArraySequence<Ts>()...);
-    
+    if (auto* zipped = dynamic_cast<const ZippedSequence<Ts...>*>(seq)) {
+        return copy_columns(zipped, std::index_sequence_for<Ts...>{});
+    }
+    std::tuple<Sequence<Ts>*...> sequences(new ArraySequence<Ts>()...);
     for (int i = 0; i < seq->GetLength(); i++) {
-        auto tuple = seq->Get(i);
-        auto stdTuple = tuple.ToStdTuple();
-        
-        size_t index = 0;
-        auto append_to_seq = [&](auto& value) {
-            std::get<index>(sequences)->Append(value);
-            index++;
-        };
-        
-        std::apply([&](auto&... values) {
-            (append_to_seq(values), ...);
-        }, stdTuple);
+        unzip_row(sequences, seq->Get(i), std::index_sequence_for<Ts...>{});
     }
     return sequences;
 }
 
+// Функции для вывода последовательностей
+template <class T>
+void print(const Sequence<T>* seq) {
+    std::cout << "[ ";
+    for (int i = 0; i < seq->GetLength(); i++) {
+        if (i > 0) std::cout << ", ";
+        std::cout << seq->Get(i);
+    }
+    std::cout << " ]\n";
+}
+
+template <class T1, class T2>
+void print(const Sequence<MonadPair<T1, T2>>* seq) {
+    std::cout << "[ ";
+    for (int i = 0; i < seq->GetLength(); i++) {
+        if (i > 0) std::cout << ", ";
+        auto p = seq->Get(i);
+        std::cout << "(" << p.first << ", " << p.second << ")";
+    }
+    std::cout << " ]\n";
+}
+
 // Функция для вывода кортежа
 template <typename... Ts>
 void print(const Sequence<MonadTuple<Ts...>>* seq) {
@@ -70,22 +107,84 @@ void print(const Sequence<MonadTuple<Ts...>>* seq) {
     std::cout << " ]\n";
 }
 
-// Остальные функции остаются без изменений
+// Виртуальный интерфейс поверх StaticFunctions.h: конкретный тип
+// определяется один раз, обход идёт без Get через vtable
 template <class T, class R>
 Sequence<R>* map(const Sequence<T>* seq, R (*f)(const T&)) {
-    Sequence<R>* result = new ArraySequence<R>();
-    for (int i = 0; i < seq->GetLength(); i++) {
-        R val = f(seq->Get(i));
-        result->Append(val);
+    return static_map(*seq, f);
+}
+
+template <class T>
+Sequence<T>* where(const Sequence<T>* seq, bool (*predicate)(const T&)) {
+    return static_where(*seq, predicate);
+}
+
+// Известные моноиды: reduce узнаёт их по адресу функции и для
+// ArraySequence<int/float/double> и срезов считает векторным ядром из SimdKernels.h
+template <class T>
+T SumOp(const T& a, const T& b) {
+    return a + b;
+}
+
+template <class T>
+T MinOp(const T& a, const T& b) {
+    return b < a ? b : a;
+}
+
+template <class T>
+T MaxOp(const T& a, const T& b) {
+    return a < b ? b : a;
+}
+
+// true, если f - известная операция и result посчитан ядром
+template <class T>
+bool reduce_known(const T* data, int n, T (*f)(const T&, const T&), T startVal, T& result) {
+    if constexpr (simd::IsKernelType<T>::value) {
+        if (f == &SumOp<T>) {
+            result = SumOp(simd::Sum(data, n), startVal);
+            return true;
+        }
+        if (f == &MinOp<T>) {
+            result = n == 0 ? startVal : MinOp(simd::Min(data, n), startVal);
+            return true;
+        }
+        if (f == &MaxOp<T>) {
+            result = n == 0 ? startVal : MaxOp(simd::Max(data, n), startVal);
+            return true;
+        }
+    }
+    (void)data; (void)n; (void)f; (void)startVal; (void)result;
+    return false;
+}
+
+template <class T>
+T reduce(const Sequence<T>* seq, T (*f)(const T&, const T&), T startVal) {
+    if constexpr (simd::IsKernelType<T>::value) {
+        if (const ArraySequence<T>* array = dynamic_cast<const ArraySequence<T>*>(seq)) {
+            T result;
+            if (reduce_known(array->GetData(), array->GetLength(), f, startVal, result)) {
+                return result;
+            }
+        }
+    }
+    return static_reduce(*seq, f, startVal);
+}
+
+// Версии для срезов: работают прямо по буферу источника без копирования
+template <class T, class R>
+Sequence<R>* map(SequenceView<T> view, R (*f)(const T&)) {
+    ArraySequence<R>* result = new ArraySequence<R>(view.GetLength());
+    R* dst = result->GetData();
+    for (int i = 0; i < view.GetLength(); i++) {
+        dst[i] = f(view.GetData()[i]);
     }
     return result;
 }
 
 template <class T>
-Sequence<T>* where(const Sequence<T>* seq, bool (*predicate)(const T&)) {
+Sequence<T>* where(SequenceView<T> view, bool (*predicate)(const T&)) {
     Sequence<T>* result = new ArraySequence<T>();
-    for (int i = 0; i < seq->GetLength(); i++) {
-        T elem = seq->Get(i);
+    for (const T& elem : view) {
         if (predicate(elem)) {
             result->Append(elem);
         }
@@ -94,14 +193,51 @@ Sequence<T>* where(const Sequence<T>* seq, bool (*predicate)(const T&)) {
 }
 
 template <class T>
-T reduce(const Sequence<T>* seq, T (*f)(const T&, const T&), T startVal) {
+T reduce(SequenceView<T> view, T (*f)(const T&, const T&), T startVal) {
+    T result;
+    if (reduce_known(view.GetData(), view.GetLength(), f, startVal, result)) {
+        return result;
+    }
     T accum = startVal;
-    for (int i = 0; i < seq->GetLength(); i++) {
-        accum = f(seq->Get(i), accum);
+    for (const T& elem : view) {
+        accum = f(elem, accum);
     }
     return accum;
 }
 
+// Число элементов, равных value
+template <class T>
+int count_of(const Sequence<T>* seq, const T& value) {
+    if constexpr (simd::IsKernelType<T>::value) {
+        if (const ArraySequence<T>* array = dynamic_cast<const ArraySequence<T>*>(seq)) {
+            return simd::Count(array->GetData(), array->GetLength(), value);
+        }
+    }
+    int result = 0;
+    for (int i = 0; i < seq->GetLength(); i++) {
+        if (seq->Get(i) == value) {
+            result++;
+        }
+    }
+    return result;
+}
+
+// Индекс первого элемента, равного value, или -1
+template <class T>
+int index_of(const Sequence<T>* seq, const T& value) {
+    if constexpr (simd::IsKernelType<T>::value) {
+        if (const ArraySequence<T>* array = dynamic_cast<const ArraySequence<T>*>(seq)) {
+            return simd::Find(array->GetData(), array->GetLength(), value);
+        }
+    }
+    for (int i = 0; i < seq->GetLength(); i++) {
+        if (seq->Get(i) == value) {
+            return i;
+        }
+    }
+    return -1;
+}
+
 template <class T1, class T2>
 Sequence<MonadPair<T1, T2>>* zip(const Sequence<T1>* s1, const Sequence<T2>* s2) {
     int minLen = (s1->GetLength() < s2->GetLength()) 
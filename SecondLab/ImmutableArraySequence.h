@@ -33,9 +33,39 @@ public:
         return newSeq;
     }
 
+    virtual Sequence<T>* RemoveAt(int index) override {
+        auto* newSeq = new ImmutableArraySequence<T>(*this);
+        newSeq->ArraySequence<T>::RemoveAt(index);
+        return newSeq;
+    }
+
+    virtual Sequence<T>* AppendRange(const T* items, int count) override {
+        auto* newSeq = new ImmutableArraySequence<T>(*this);
+        newSeq->ArraySequence<T>::AppendRange(items, count);
+        return newSeq;
+    }
+
+    virtual Sequence<T>* InsertRange(const T* items, int count, int index) override {
+        auto* newSeq = new ImmutableArraySequence<T>(*this);
+        newSeq->ArraySequence<T>::InsertRange(items, count, index);
+        return newSeq;
+    }
+
+    virtual Sequence<T>* RemoveRange(int startIndex, int endIndex) override {
+        auto* newSeq = new ImmutableArraySequence<T>(*this);
+        newSeq->ArraySequence<T>::RemoveRange(startIndex, endIndex);
+        return newSeq;
+    }
+
     virtual Sequence<T>* Concat(const Sequence<T>* seq) const override {
         auto* newSeq = new ImmutableArraySequence<T>(*this);
-        newSeq->ArraySequence<T>::Concat(seq);
+        if (auto* other = dynamic_cast<const ArraySequence<T>*>(seq)) {
+            newSeq->ArraySequence<T>::AppendRange(other->GetData(), other->GetLength());
+            return newSeq;
+        }
+        for (int i = 0; i < seq->GetLength(); i++) {
+            newSeq->ArraySequence<T>::Append(seq->Get(i));
+        }
         return newSeq;
     }
 
@@ -33,12 +33,71 @@ public:
         return newSeq;
     }
 
+    virtual Sequence<T>* RemoveAt(int index) override {
+        auto* newSeq = new ImmutableListSequence<T>(*this);
+        newSeq->ListSequence<T>::RemoveAt(index);
+        return newSeq;
+    }
+
+    virtual Sequence<T>* AppendRange(const T* items, int count) override {
+        auto* newSeq = new ImmutableListSequence<T>(*this);
+        newSeq->ListSequence<T>::AppendRange(items, count);
+        return newSeq;
+    }
+
+    virtual Sequence<T>* InsertRange(const T* items, int count, int index) override {
+        auto* newSeq = new ImmutableListSequence<T>(*this);
+        newSeq->ListSequence<T>::InsertRange(items, count, index);
+        return newSeq;
+    }
+
+    virtual Sequence<T>* RemoveRange(int startIndex, int endIndex) override {
+        auto* newSeq = new ImmutableListSequence<T>(*this);
+        newSeq->ListSequence<T>::RemoveRange(startIndex, endIndex);
+        return newSeq;
+    }
+
     virtual Sequence<T>* Concat(const Sequence<T>* seq) const override {
         auto* newSeq = new ImmutableListSequence<T>(*this);
-        newSeq->ListSequence<T>::Concat(seq);
+        newSeq->AppendCopyOf(seq);
+        return newSeq;
+    }
+
+    virtual bool IsImmutable() const override {
+        return true;
+    }
+
+    // Absorb/Splice/SplitAt без передачи узлов: ни this, ни other не меняются,
+    // результат - новая неизменяемая последовательность из копий
+    virtual ListSequence<T>* Absorb(ListSequence<T>* other) override {
+        ListSequence<T> copy(*other);
+        auto* newSeq = new ImmutableListSequence<T>(*this);
+        newSeq->ListSequence<T>::Absorb(&copy);
         return newSeq;
     }
 
+    virtual ListSequence<T>* Splice(ListSequence<T>* other, int index) override {
+        ListSequence<T> copy(*other);
+        auto* newSeq = new ImmutableListSequence<T>(*this);
+        try {
+            newSeq->ListSequence<T>::Splice(&copy, index);
+        } catch (...) {
+            delete newSeq;
+            throw;
+        }
+        return newSeq;
+    }
+
+    // Копия элементов [index, GetLength())
+    virtual ListSequence<T>* SplitAt(int index) override {
+        ListSequence<T> copy(*this);
+        ListSequence<T>* tail = copy.ListSequence<T>::SplitAt(index);
+        auto* result = new ImmutableListSequence<T>();
+        result->ListSequence<T>::Absorb(tail);
+        delete tail;
+        return result;
+    }
+
     virtual Sequence<T>* Clone() const override {
         return new ImmutableListSequence<T>(*this);
     }
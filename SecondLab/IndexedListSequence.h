@@ -0,0 +1,390 @@
+#pragma once
+#include "Sequence.h"
+#include "LinkedList.h"
+#include "Exeption.h"
+#include <functional>
+#include <cstddef>
+#include <cstdint>
+
+// Доступ к узлам LinkedList для индекса (LinkedList объявляет LLHook другом)
+template <class List>
+struct LLHook {
+    typedef typename List::Node Node;
+
+    static Node* Head(const List& list) {
+        return list.head;
+    }
+
+    static Node* Tail(const List& list) {
+        return list.tail;
+    }
+
+    static Node* NextOf(const Node* node) {
+        return node->next;
+    }
+
+    static const typename List::Node* NodeAt(const List& list, int index) {
+        Node* current = list.head;
+        for (int i = 0; i < index; i++) {
+            current = current->next;
+        }
+        return current;
+    }
+};
+
+// Список с индексом значение -> первый узел с этим значением.
+// Индекс - хеш-таблица с открытой адресацией (линейное пробирование),
+// в слоте только указатель на узел и число повторов значения, сам ключ
+// лежит в узле. Contains/Find/Next/Count - O(1) в среднем.
+//
+// Память индекса: GetIndexCapacity() слотов по sizeof(слот) байт,
+// итог в GetIndexMemory(). Таблица растёт вдвое, когда заполненность
+// превышает maxLoadFactor (по умолчанию 0.5): меньше - быстрее поиск,
+// больше - меньше памяти.
+template <class T, class Hash = std::hash<T>>
+class IndexedListSequence : public Sequence<T> {
+private:
+    typedef LinkedList<T> List;
+    typedef LLHook<List> Hook;
+    typedef typename Hook::Node Node;
+
+    struct Slot {
+        const Node* node;
+        int count;
+    };
+
+    List* list;
+    Slot* slots;
+    int capacity;
+    int used;
+    double maxLoadFactor;
+    Hash hasher;
+
+    int Home(const T& value) const {
+        // Фибоначчиево перемешивание: плохие std::hash (тождественный для int) не слипаются
+        std::uint64_t h = static_cast<std::uint64_t>(hasher(value)) * 0x9E3779B97F4A7C15ull;
+        return static_cast<int>(h >> 32) & (capacity - 1);
+    }
+
+    int FindSlot(const T& value) const {
+        int i = Home(value);
+        while (slots[i].node) {
+            if (slots[i].node->data == value) {
+                return i;
+            }
+            i = (i + 1) & (capacity - 1);
+        }
+        return -1;
+    }
+
+    void Allocate(int newCapacity) {
+        slots = new Slot[newCapacity];
+        for (int i = 0; i < newCapacity; i++) {
+            slots[i].node = nullptr;
+            slots[i].count = 0;
+        }
+        capacity = newCapacity;
+        used = 0;
+    }
+
+    void PlaceNew(const Node* node, int count) {
+        int i = Home(node->data);
+        while (slots[i].node) {
+            i = (i + 1) & (capacity - 1);
+        }
+        slots[i].node = node;
+        slots[i].count = count;
+        used++;
+    }
+
+    void Rehash(int newCapacity) {
+        Slot* old = slots;
+        int oldCapacity = capacity;
+        Allocate(newCapacity);
+        for (int i = 0; i < oldCapacity; i++) {
+            if (old[i].node) {
+                PlaceNew(old[i].node, old[i].count);
+            }
+        }
+        delete[] old;
+    }
+
+    static int CapacityFor(int entries, double loadFactor) {
+        int result = 8;
+        while (result * loadFactor < entries + 1) {
+            result *= 2;
+        }
+        return result;
+    }
+
+    // Узел node встретился в списке; first - он идёт раньше уже записанного
+    void IndexNode(const Node* node, bool first) {
+        int i = FindSlot(node->data);
+        if (i >= 0) {
+            slots[i].count++;
+            if (first) {
+                slots[i].node = node;
+            }
+            return;
+        }
+        if (used + 1 > capacity * maxLoadFactor) {
+            Rehash(capacity * 2);
+        }
+        PlaceNew(node, 1);
+    }
+
+    // Удаление без надгробий: следующие слоты кластера сдвигаются назад
+    void EraseSlot(int i) {
+        int mask = capacity - 1;
+        int j = i;
+        while (true) {
+            j = (j + 1) & mask;
+            if (!slots[j].node) {
+                break;
+            }
+            int home = Home(slots[j].node->data);
+            bool between = (i <= j) ? (i < home && home <= j) : (i < home || home <= j);
+            if (!between) {
+                slots[i] = slots[j];
+                i = j;
+            }
+        }
+        slots[i].node = nullptr;
+        slots[i].count = 0;
+        used--;
+    }
+
+    // Узел node сейчас будет удалён из списка
+    void UnindexNode(const Node* node) {
+        int i = FindSlot(node->data);
+        if (--slots[i].count == 0) {
+            EraseSlot(i);
+            return;
+        }
+        if (slots[i].node == node) {
+            const Node* next = Hook::NextOf(node);
+            while (!(next->data == node->data)) {
+                next = Hook::NextOf(next);
+            }
+            slots[i].node = next;
+        }
+    }
+
+    void Rebuild() {
+        delete[] slots;
+        Allocate(CapacityFor(list->GetLength(), maxLoadFactor));
+        const Node* current = Hook::Head(*list);
+        for (int i = 0; i < list->GetLength(); i++) {
+            IndexNode(current, false);
+            current = Hook::NextOf(current);
+        }
+    }
+
+    static double CheckLoadFactor(double loadFactor) {
+        if (!(loadFactor > 0.0 && loadFactor < 1.0)) {
+            throw MyException(ErrorType::InvalidArg, -1);
+        }
+        return loadFactor;
+    }
+
+    explicit IndexedListSequence(List* owned, double loadFactor)
+        : list(owned), slots(nullptr), capacity(0), used(0), maxLoadFactor(loadFactor) {
+        Rebuild();
+    }
+
+public:
+    explicit IndexedListSequence(double loadFactor = 0.5)
+        : IndexedListSequence(new List(), CheckLoadFactor(loadFactor)) {}
+
+    IndexedListSequence(T* arr, int count, double loadFactor = 0.5)
+        : IndexedListSequence(new List(arr, count), CheckLoadFactor(loadFactor)) {}
+
+    IndexedListSequence(const IndexedListSequence& other)
+        : IndexedListSequence(new List(*other.list), other.maxLoadFactor) {}
+
+    IndexedListSequence& operator=(const IndexedListSequence& other) {
+        if (this != &other) {
+            *list = *other.list;
+            maxLoadFactor = other.maxLoadFactor;
+            Rebuild();
+        }
+        return *this;
+    }
+
+    virtual ~IndexedListSequence() {
+        delete[] slots;
+        delete list;
+    }
+
+    bool Contains(const T& value) const {
+        return FindSlot(value) >= 0;
+    }
+
+    // Первый элемент, равный value, или nullptr
+    const T* Find(const T& value) const {
+        int i = FindSlot(value);
+        return i >= 0 ? &slots[i].node->data : nullptr;
+    }
+
+    int Count(const T& value) const {
+        int i = FindSlot(value);
+        return i >= 0 ? slots[i].count : 0;
+    }
+
+    // Элемент после первого вхождения value, как LinkedList::Next
+    const T& Next(const T& value) const {
+        int i = FindSlot(value);
+        if (i < 0) {
+            throw MyException(ErrorType::InvalidArg, 6);
+        }
+        const Node* next = Hook::NextOf(slots[i].node);
+        if (!next) {
+            throw MyException(ErrorType::OutOfRange, 3);
+        }
+        return next->data;
+    }
+
+    int GetIndexCapacity() const {
+        return capacity;
+    }
+
+    size_t GetIndexMemory() const {
+        return static_cast<size_t>(capacity) * sizeof(Slot);
+    }
+
+    double GetMaxLoadFactor() const {
+        return maxLoadFactor;
+    }
+
+    void SetMaxLoadFactor(double loadFactor) {
+        maxLoadFactor = CheckLoadFactor(loadFactor);
+        Rehash(CapacityFor(used, maxLoadFactor));
+    }
+
+    // Заранее готовит индекс под distinct различных значений
+    void ReserveIndex(int distinct) {
+        if (distinct < 0) {
+            throw MyException(ErrorType::NegativeSize, 0);
+        }
+        int wanted = CapacityFor(distinct, maxLoadFactor);
+        if (wanted > capacity) {
+            Rehash(wanted);
+        }
+    }
+
+    virtual T GetFirst() const override {
+        return list->GetFirst();
+    }
+
+    virtual T GetLast() const override {
+        return list->GetLast();
+    }
+
+    virtual T Get(int index) const override {
+        return list->Get(index);
+    }
+
+    virtual int GetLength() const override {
+        return list->GetLength();
+    }
+
+    template <class F>
+    void ForEach(F f) const {
+        list->ForEach(f);
+    }
+
+    // Обход через Sequence<T>: один проход ForEach вместо n вызовов Get
+    virtual void VisitItems(void (*visit)(const T&, void*), void* context) const override {
+        ForEach([&](const T& item) { visit(item, context); });
+    }
+
+    virtual Sequence<T>* GetSubsequence(int startIndex, int endIndex) const override {
+        return new IndexedListSequence(list->GetSubList(startIndex, endIndex), maxLoadFactor);
+    }
+
+    virtual Sequence<T>* Append(const T& item) override {
+        list->Append(item);
+        IndexNode(Hook::Tail(*list), false);
+        return this;
+    }
+
+    virtual Sequence<T>* Prepend(const T& item) override {
+        list->Prepend(item);
+        IndexNode(Hook::Head(*list), true);
+        return this;
+    }
+
+    virtual Sequence<T>* InsertAt(const T& item, int index) override {
+        list->InsertAt(item, index);
+        const Node* inserted = Hook::NodeAt(*list, index);
+        int i = FindSlot(item);
+        bool first = true;
+        if (i >= 0) {
+            // Новый узел первый, если записанного нет среди узлов [0, index)
+            const Node* current = Hook::Head(*list);
+            for (int k = 0; k < index; k++) {
+                if (current == slots[i].node) {
+                    first = false;
+                    break;
+                }
+                current = Hook::NextOf(current);
+            }
+        }
+        IndexNode(inserted, first);
+        return this;
+    }
+
+    virtual Sequence<T>* RemoveAt(int index) override {
+        if (index >= 0 && index < list->GetLength()) {
+            UnindexNode(Hook::NodeAt(*list, index));
+        }
+        list->RemoveAt(index);
+        return this;
+    }
+
+    // Вставка в середину меняет порядок первых вхождений - индекс строится заново
+    virtual Sequence<T>* InsertRange(const T* items, int count, int index) override {
+        list->InsertRange(items, count, index);
+        Rebuild();
+        return this;
+    }
+
+    virtual Sequence<T>* RemoveRange(int startIndex, int endIndex) override {
+        list->RemoveRange(startIndex, endIndex);
+        Rebuild();
+        return this;
+    }
+
+    virtual Sequence<T>* Concat(const Sequence<T>* seq) const override {
+        IndexedListSequence* result = new IndexedListSequence(*this);
+        for (int i = 0; i < seq->GetLength(); i++) {
+            result->Append(seq->Get(i));
+        }
+        return result;
+    }
+
+    void reverse() {
+        list->reverse();
+        Rebuild();
+    }
+
+    template <class Compare>
+    void Sort(Compare less) {
+        list->Sort(less);
+        Rebuild();
+    }
+
+    virtual const char* TypeName() const override {
+        return "IndexedListSequence";
+    }
+
+    virtual Sequence<T>* Clone() const override {
+        return new IndexedListSequence(*this);
+    }
+};
+
+// Для static_map/static_where/static_reduce из StaticFunctions.h
+template <class T, class H, class F>
+void static_for_each(const IndexedListSequence<T, H>& seq, F f) {
+    seq.ForEach(f);
+}
@@ -3,20 +3,68 @@
 #include <initializer_list>
 #include <unordered_set>
 #include "Exeption.h"
+#include "CheckPolicy.h"
+#include "SequenceStats.h"
 
-template <class T>
+template <class T, class CheckPolicy = CheckedPolicy>
 class LinkedList {
 private:
     struct Node {
         T data;
         Node* next;
-        Node(const T& value) : data(value), next(nullptr) {}
+        Node(const T& value) : data(value), next(nullptr) {
+            SEQ_STAT_ALLOC(sizeof(Node));
+            SEQ_STAT_ADD(ElementCopies, 1);
+        }
+        ~Node() {
+            SEQ_STAT_ADD(Deallocations, 1);
+        }
     };
     Node* head;
     Node* tail;
     int length;
 
     template<class U> friend struct LLHook;
+
+    template <class Compare>
+    static Node* TakeRun(Node* start, Compare& less) {
+        Node* end = start;
+        while (end->next && !less(end->next->data, end->data)) {
+            end = end->next;
+        }
+        return end;
+    }
+
+    template <class Compare>
+    static Node* MergeRuns(Node* a, Node* b, Compare& less, Node*& last) {
+        Node* first = nullptr;
+        Node** link = &first;
+        while (a && b) {
+            if (less(b->data, a->data)) {
+                *link = b;
+                b = b->next;
+            } else {
+                *link = a;
+                a = a->next;
+            }
+            link = &(*link)->next;
+        }
+        *link = a ? a : b;
+        last = *link;
+        while (last->next) {
+            last = last->next;
+        }
+        return first;
+    }
+
+    static void AppendChain(Node*& first, Node*& last, Node* chainHead, Node* chainTail) {
+        if (!first) {
+            first = chainHead;
+        } else {
+            last->next = chainHead;
+        }
+        last = chainTail;
+    }
 public:
     LinkedList() : head(nullptr), tail(nullptr), length(0) {}
 
@@ -32,7 +80,7 @@ public:
         }
     }
 
-    LinkedList(const LinkedList<T>& other) : LinkedList() {
+    LinkedList(const LinkedList& other) : LinkedList() {
         Node* current = other.head;
         while (current) {
             Append(current->data);
@@ -86,35 +134,36 @@ public:
     }
 
     T& Get(int index) {
-        if (index < 0) {
-            throw MyException(ErrorType::OutOfRange, 0);
-        }
-        if (index >= length) {
-            throw MyException(ErrorType::OutOfRange, 1);
-        }
+        CheckPolicy::CheckIndex(index, length);
+        return GetUnchecked(index);
+    }
+
+    const T& Get(int index) const {
+        return const_cast<LinkedList*>(this)->Get(index);
+    }
+
+    T& GetUnchecked(int index) {
         Node* current = head;
         for (int i = 0; i < index; i++) {
             current = current->next;
         }
+        SEQ_STAT_ADD(NodeHops, index);
         return current->data;
     }
 
-    const T& Get(int index) const {
-        return const_cast<LinkedList*>(this)->Get(index);
-    }
-
-    LinkedList<T>* GetSubList(int startIndex, int endIndex) const {
+    LinkedList* GetSubList(int startIndex, int endIndex) const {
         if (startIndex < 0) {
             throw MyException(ErrorType::OutOfRange, 0);
         }
         if (endIndex < 0 || startIndex >= length || endIndex >= length || startIndex > endIndex) {
             throw MyException(ErrorType::OutOfRange, 1);
         }
-        LinkedList<T>* subList = new LinkedList<T>();
+        LinkedList* subList = new LinkedList();
         Node* current = head;
         for (int i = 0; i < startIndex; i++) {
             current = current->next;
         }
+        SEQ_STAT_ADD(NodeHops, startIndex);
         for (int i = startIndex; i <= endIndex; i++) {
             subList->Append(current->data);
             current = current->next;
@@ -126,6 +175,16 @@ public:
         return length;
     }
 
+    // Проход по узлам за O(n); ограничен length, поэтому безопасен и для цикла
+    template <class F>
+    void ForEach(F f) const {
+        const Node* current = head;
+        for (int i = 0; i < length; i++) {
+            f(static_cast<const T&>(current->data));
+            current = current->next;
+        }
+    }
+
     void Append(const T& item) {
         Node* newNode = new Node(item);
         if (length == 0) {
@@ -158,6 +217,7 @@ public:
         for (int i = 0; i < index - 1; i++) {
             current = current->next;
         }
+        SEQ_STAT_ADD(NodeHops, index - 1);
         Node* toDel = current->next;
         current->next = toDel->next;
         delete toDel;
@@ -197,12 +257,102 @@ public:
         for (int i = 0; i < index - 1; i++) {
             current = current->next;
         }
+        SEQ_STAT_ADD(NodeHops, index - 1);
         newNode->next = current->next;
         current->next = newNode;
         length++;
     }
 
-    LinkedList<T>* Concat(LinkedList<T>* list) {
+    // Цепочка из count новых узлов строится отдельно и вшивается одной перевязкой
+    void InsertRange(const T* items, int count, int index) {
+        if (count < 0) {
+            throw MyException(ErrorType::NegativeSize, 0);
+        }
+        if (index < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (index > length) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        if (count == 0) {
+            return;
+        }
+        Node* first = new Node(items[0]);
+        Node* last = first;
+        try {
+            for (int i = 1; i < count; i++) {
+                last->next = new Node(items[i]);
+                last = last->next;
+            }
+        } catch (...) {
+            // Недостроенная цепочка ещё не вшита в список
+            while (first) {
+                Node* next = first->next;
+                delete first;
+                first = next;
+            }
+            throw;
+        }
+        if (index == 0) {
+            last->next = head;
+            head = first;
+            if (length == 0) {
+                tail = last;
+            }
+        } else if (index == length) {
+            tail->next = first;
+            tail = last;
+        } else {
+            Node* prev = head;
+            for (int i = 0; i < index - 1; i++) {
+                prev = prev->next;
+            }
+            SEQ_STAT_ADD(NodeHops, index - 1);
+            last->next = prev->next;
+            prev->next = first;
+        }
+        length += count;
+    }
+
+    void AppendRange(const T* items, int count) {
+        InsertRange(items, count, length);
+    }
+
+    // Удаляет узлы [startIndex, endIndex] за один проход
+    void RemoveRange(int startIndex, int endIndex) {
+        if (startIndex < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (endIndex < 0 || startIndex > endIndex || endIndex >= length) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        Node* prev = nullptr;
+        Node* current = head;
+        for (int i = 0; i < startIndex; i++) {
+            prev = current;
+            current = current->next;
+        }
+        SEQ_STAT_ADD(NodeHops, startIndex);
+        for (int i = startIndex; i <= endIndex; i++) {
+            Node* next = current->next;
+            delete current;
+            current = next;
+        }
+        if (prev) {
+            prev->next = current;
+        } else {
+            head = current;
+        }
+        if (!current) {
+            tail = prev;
+        }
+        length -= endIndex - startIndex + 1;
+    }
+
+    LinkedList* Concat(LinkedList* list) {
+        if (list == this) {
+            throw MyException(ErrorType::SequenceError, 1);
+        }
         if (!list || list->length == 0) {
             return this;
         }
@@ -221,6 +371,74 @@ public:
         return this;
     }
 
+    // Вшивает все узлы list перед позицией index без копирования; list становится пустым.
+    // O(1) для index == 0 и index == GetLength(), иначе O(index)
+    LinkedList* Splice(LinkedList* list, int index) {
+        if (list == this) {
+            throw MyException(ErrorType::SequenceError, 1);
+        }
+        if (index < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (index > length) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        if (!list || list->length == 0) {
+            return this;
+        }
+        if (index == length) {
+            return Concat(list);
+        }
+        if (index == 0) {
+            list->tail->next = head;
+            head = list->head;
+        } else {
+            Node* prev = head;
+            for (int i = 0; i < index - 1; i++) {
+                prev = prev->next;
+            }
+            SEQ_STAT_ADD(NodeHops, index - 1);
+            list->tail->next = prev->next;
+            prev->next = list->head;
+        }
+        length += list->length;
+        list->head = nullptr;
+        list->tail = nullptr;
+        list->length = 0;
+        return this;
+    }
+
+    // Отрезает узлы [index, GetLength()) в новый список без копирования, O(index)
+    LinkedList* SplitAt(int index) {
+        if (index < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (index > length) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        LinkedList* rest = new LinkedList();
+        if (index == length) {
+            return rest;
+        }
+        rest->tail = tail;
+        if (index == 0) {
+            rest->head = head;
+            head = tail = nullptr;
+        } else {
+            Node* prev = head;
+            for (int i = 0; i < index - 1; i++) {
+                prev = prev->next;
+            }
+            SEQ_STAT_ADD(NodeHops, index - 1);
+            rest->head = prev->next;
+            prev->next = nullptr;
+            tail = prev;
+        }
+        rest->length = length - index;
+        length = index;
+        return rest;
+    }
+
     void reverse() {
         Node* prev = nullptr;
         Node* curr = head;
@@ -239,6 +457,40 @@ public:
         }
     }
 
+    // Естественная сортировка слиянием: узлы перевязываются, элементы не копируются
+    template <class Compare>
+    void Sort(Compare less) {
+        if (length < 2) {
+            return;
+        }
+        bool merged = true;
+        while (merged) {
+            merged = false;
+            Node* rest = head;
+            Node* newHead = nullptr;
+            Node* newTail = nullptr;
+            while (rest) {
+                Node* left = rest;
+                Node* leftEnd = TakeRun(left, less);
+                Node* right = leftEnd->next;
+                leftEnd->next = nullptr;
+                if (!right) {
+                    AppendChain(newHead, newTail, left, leftEnd);
+                    break;
+                }
+                Node* rightEnd = TakeRun(right, less);
+                rest = rightEnd->next;
+                rightEnd->next = nullptr;
+                Node* mergedEnd = nullptr;
+                Node* mergedHead = MergeRuns(left, right, less, mergedEnd);
+                AppendChain(newHead, newTail, mergedHead, mergedEnd);
+                merged = true;
+            }
+            head = newHead;
+            tail = newTail;
+        }
+    }
+
     void MakeCycle(int idx) {
         if (idx < 0 || idx >= length || length == 0) {
             return;
@@ -310,7 +562,7 @@ public:
     }
 
 
-    LinkedList<T>& operator=(const LinkedList<T>& other) {
+    LinkedList& operator=(const LinkedList& other) {
         if (this != &other) {
             Clear();
             Node* current = other.head;
@@ -6,6 +6,19 @@ template <class T>
 class ListSequence : public Sequence<T> {
 protected:
     LinkedList<T>* list;
+
+    // Список копируется обходом узлов, а не Get(i) за O(i) на каждый элемент
+    void AppendCopyOf(const Sequence<T>* seq) {
+        if (const ListSequence<T>* other = dynamic_cast<const ListSequence<T>*>(seq)) {
+            LinkedList<T> copy(*other->list);
+            list->Concat(&copy);
+            return;
+        }
+        for (int i = 0; i < seq->GetLength(); i++) {
+            list->Append(seq->Get(i));
+        }
+    }
+
 public:
     ListSequence() {
         list = new LinkedList<T>();
@@ -27,22 +40,32 @@ public:
         delete list;
     }
 
-    virtual T GetFirst() const override {
+    virtual T GetFirst() const final {
         return list->GetFirst();
     }
 
-    virtual T GetLast() const override {
+    virtual T GetLast() const final {
         return list->GetLast();
     }
 
-    virtual T Get(int index) const override {
+    virtual T Get(int index) const final {
         return list->Get(index);
     }
 
-    virtual int GetLength() const override {
+    virtual int GetLength() const final {
         return list->GetLength();
     }
 
+    template <class F>
+    void ForEach(F f) const {
+        list->ForEach(f);
+    }
+
+    // Обход через Sequence<T>: один проход ForEach вместо n вызовов Get
+    virtual void VisitItems(void (*visit)(const T&, void*), void* context) const override {
+        ForEach([&](const T& item) { visit(item, context); });
+    }
+
     virtual Sequence<T>* GetSubsequence(int startIndex, int endIndex) const override {
         if (startIndex < 0 || endIndex < 0) {
             throw MyException(ErrorType::OutOfRange, 0);
@@ -81,11 +104,58 @@ public:
         return this;
     }
 
+    virtual Sequence<T>* AppendRange(const T* items, int count) override {
+        list->AppendRange(items, count);
+        return this;
+    }
+
+    virtual Sequence<T>* InsertRange(const T* items, int count, int index) override {
+        list->InsertRange(items, count, index);
+        return this;
+    }
+
+    virtual Sequence<T>* RemoveRange(int startIndex, int endIndex) override {
+        list->RemoveRange(startIndex, endIndex);
+        return this;
+    }
+
+    // Константная версия копирует обе части: O(n + m).
+    // Без копирования склеивают Absorb и Splice.
     virtual Sequence<T>* Concat(const Sequence<T>* seq) const override {
         ListSequence<T>* result = new ListSequence<T>(*this);
-        for (int i = 0; i < seq->GetLength(); i++) {
-            result->Append(seq->Get(i));
+        result->AppendCopyOf(seq);
+        return result;
+    }
+
+    // Неизменяемый список нельзя опустошить, забрав его узлы
+    virtual bool IsImmutable() const {
+        return false;
+    }
+
+    // Забирает все узлы other в конец за O(1); other становится пустой
+    virtual ListSequence<T>* Absorb(ListSequence<T>* other) {
+        if (other->IsImmutable()) {
+            throw MyException(ErrorType::SequenceError, 1);
+        }
+        list->Concat(other->list);
+        return this;
+    }
+
+    // Вшивает узлы other перед позицией index; other становится пустой
+    virtual ListSequence<T>* Splice(ListSequence<T>* other, int index) {
+        if (other->IsImmutable()) {
+            throw MyException(ErrorType::SequenceError, 1);
         }
+        list->Splice(other->list, index);
+        return this;
+    }
+
+    // Отрезает элементы [index, GetLength()) в новую последовательность без копирования
+    virtual ListSequence<T>* SplitAt(int index) {
+        LinkedList<T>* rest = list->SplitAt(index);
+        ListSequence<T>* result = new ListSequence<T>();
+        delete result->list;
+        result->list = rest;
         return result;
     }
 
@@ -93,6 +163,11 @@ public:
         list->reverse();
     }
 
+    template <class Compare>
+    void Sort(Compare less) {
+        list->Sort(less);
+    }
+
     void ReverseSmart() {
         list->ReverseSmart();
     }
@@ -104,4 +179,10 @@ public:
     virtual Sequence<T>* Clone() const override {
         return new ListSequence<T>(*this);
     }
-};
\ No newline at end of file
+};
+
+// Для static_map/static_where/static_reduce из StaticFunctions.h
+template <class T, class F>
+void static_for_each(const ListSequence<T>& seq, F f) {
+    seq.ForEach(f);
+}
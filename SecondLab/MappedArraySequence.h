@@ -0,0 +1,347 @@
+#pragma once
+#include "Sequence.h"
+#include "ArraySequence.h"
+#include "SequenceView.h"
+#include "Exeption.h"
+#include <cstdio>
+#include <cstring>
+#include <climits>
+#include <string>
+#include <type_traits>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define MAPPED_SEQUENCE_MMAP 1
+#endif
+
+enum class MapMode {
+    ReadOnly,     // запись запрещена, страницы общие с page cache
+    CopyOnWrite   // MAP_PRIVATE: изменения видны только этому объекту, файл не меняется
+};
+
+// Последовательность поверх двоичного файла из подряд записанных T.
+// Файл отображается в память (mmap): открытие мгновенное, страницы
+// подгружаются при первом обращении.
+//
+// ReadOnly: любые изменения бросают SequenceError 1.
+// CopyOnWrite: Set/RemoveAt/RemoveRange меняют отображение на месте,
+// а операции, увеличивающие длину, один раз переносят данные в кучу
+// (обычный ArraySequence) и дальше работают с ним.
+// Пока последовательность открыта, файл нельзя обрезать: чтение
+// пропавших страниц завершит процесс по SIGBUS.
+// Без mmap (не POSIX) файл читается в кучу целиком при открытии.
+template <class T>
+class MappedArraySequence : public Sequence<T> {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "MappedArraySequence needs trivially copyable elements");
+
+private:
+    T* mapped;
+    size_t mappedBytes;
+    int count;
+    ArraySequence<T>* heap;
+    MapMode mode;
+    std::string path;
+
+    const T* Data() const {
+        return heap ? heap->GetData() : mapped;
+    }
+
+    void CheckWritable() const {
+        if (mode == MapMode::ReadOnly) {
+            throw MyException(ErrorType::SequenceError, 1);
+        }
+    }
+
+    void CheckIndex(int index) const {
+        if (index < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (index >= GetLength()) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+    }
+
+    void Unmap() {
+#ifdef MAPPED_SEQUENCE_MMAP
+        if (mapped) {
+            munmap(mapped, mappedBytes);
+        }
+#else
+        delete[] reinterpret_cast<char*>(mapped);
+#endif
+        mapped = nullptr;
+        mappedBytes = 0;
+    }
+
+    // Перед ростом: данные уезжают в кучу, отображение закрывается
+    ArraySequence<T>* Heap() {
+        CheckWritable();
+        if (!heap) {
+            heap = new ArraySequence<T>(mapped, count);
+            Unmap();
+        }
+        return heap;
+    }
+
+    static int CountFor(long long bytes) {
+        if (bytes % static_cast<long long>(sizeof(T)) != 0 ||
+            bytes / static_cast<long long>(sizeof(T)) > INT_MAX) {
+            throw MyException(ErrorType::FileError, 1);
+        }
+        return static_cast<int>(bytes / static_cast<long long>(sizeof(T)));
+    }
+
+    void Open() {
+#ifdef MAPPED_SEQUENCE_MMAP
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw MyException(ErrorType::FileError, 0);
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0) {
+            close(fd);
+            throw MyException(ErrorType::FileError, 0);
+        }
+        try {
+            count = CountFor(static_cast<long long>(info.st_size));
+        } catch (...) {
+            close(fd);
+            throw;
+        }
+        if (count > 0) {
+            mappedBytes = static_cast<size_t>(info.st_size);
+            int protection = mode == MapMode::ReadOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+            int flags = mode == MapMode::ReadOnly ? MAP_SHARED : MAP_PRIVATE;
+            void* address = mmap(nullptr, mappedBytes, protection, flags, fd, 0);
+            if (address == MAP_FAILED) {
+                close(fd);
+                mappedBytes = 0;
+                throw MyException(ErrorType::FileError, 2);
+            }
+            mapped = static_cast<T*>(address);
+        }
+        // Отображение живёт и после закрытия дескриптора
+        close(fd);
+#else
+        FILE* file = std::fopen(path.c_str(), "rb");
+        if (!file) {
+            throw MyException(ErrorType::FileError, 0);
+        }
+        std::fseek(file, 0, SEEK_END);
+        long long bytes = std::ftell(file);
+        std::fseek(file, 0, SEEK_SET);
+        try {
+            count = CountFor(bytes);
+        } catch (...) {
+            std::fclose(file);
+            throw;
+        }
+        mappedBytes = static_cast<size_t>(bytes);
+        mapped = reinterpret_cast<T*>(new char[mappedBytes > 0 ? mappedBytes : 1]);
+        size_t read = std::fread(mapped, 1, mappedBytes, file);
+        std::fclose(file);
+        if (read != mappedBytes) {
+            Unmap();
+            throw MyException(ErrorType::FileError, 0);
+        }
+#endif
+    }
+
+public:
+    MappedArraySequence(const char* filePath, MapMode mapMode = MapMode::ReadOnly)
+        : mapped(nullptr), mappedBytes(0), count(0), heap(nullptr), mode(mapMode), path(filePath) {
+        Open();
+    }
+
+    // Отображение не копируется: копию даёт Clone()
+    MappedArraySequence(const MappedArraySequence&) = delete;
+    MappedArraySequence& operator=(const MappedArraySequence&) = delete;
+
+    virtual ~MappedArraySequence() {
+        Unmap();
+        delete heap;
+    }
+
+    // Записывает count элементов в файл в формате, который читает этот класс
+    static void WriteFile(const char* filePath, const T* items, int count) {
+        if (count < 0) {
+            throw MyException(ErrorType::NegativeSize, 0);
+        }
+        FILE* file = std::fopen(filePath, "wb");
+        if (!file) {
+            throw MyException(ErrorType::FileError, 0);
+        }
+        size_t written = std::fwrite(items, sizeof(T), static_cast<size_t>(count), file);
+        bool closed = std::fclose(file) == 0;
+        if (written != static_cast<size_t>(count) || !closed) {
+            throw MyException(ErrorType::FileError, 3);
+        }
+    }
+
+    MapMode GetMode() const {
+        return mode;
+    }
+
+    // true, пока данные читаются из файла, а не из кучи
+    bool IsMapped() const {
+        return heap == nullptr;
+    }
+
+    const T* GetData() const {
+        return Data();
+    }
+
+    // Срез без копирования: map/where/reduce из Functions.h работают прямо по страницам файла
+    SequenceView<T> AsView() const {
+        return SequenceView<T>(Data(), GetLength());
+    }
+
+    // Подсказки ядру о порядке чтения
+    void AdviseSequential() const {
+#ifdef MAPPED_SEQUENCE_MMAP
+        if (mapped) {
+            madvise(mapped, mappedBytes, MADV_SEQUENTIAL);
+        }
+#endif
+    }
+
+    void AdviseRandom() const {
+#ifdef MAPPED_SEQUENCE_MMAP
+        if (mapped) {
+            madvise(mapped, mappedBytes, MADV_RANDOM);
+        }
+#endif
+    }
+
+    virtual T GetFirst() const override {
+        if (GetLength() == 0) {
+            throw MyException(ErrorType::OutOfRange, 2);
+        }
+        return Data()[0];
+    }
+
+    virtual T GetLast() const override {
+        if (GetLength() == 0) {
+            throw MyException(ErrorType::OutOfRange, 2);
+        }
+        return Data()[GetLength() - 1];
+    }
+
+    virtual T Get(int index) const override {
+        CheckIndex(index);
+        return Data()[index];
+    }
+
+    virtual int GetLength() const override {
+        return heap ? heap->GetLength() : count;
+    }
+
+    void Set(int index, const T& value) {
+        CheckWritable();
+        CheckIndex(index);
+        if (heap) {
+            heap->GetData()[index] = value;
+        } else {
+            mapped[index] = value;
+        }
+    }
+
+    virtual Sequence<T>* GetSubsequence(int startIndex, int endIndex) const override {
+        if (startIndex < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (endIndex < 0 || startIndex > endIndex || endIndex >= GetLength()) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        return new ArraySequence<T>(Data() + startIndex, endIndex - startIndex + 1);
+    }
+
+    virtual Sequence<T>* Append(const T& item) override {
+        Heap()->Append(item);
+        return this;
+    }
+
+    virtual Sequence<T>* Prepend(const T& item) override {
+        Heap()->Prepend(item);
+        return this;
+    }
+
+    virtual Sequence<T>* InsertAt(const T& item, int index) override {
+        Heap()->InsertAt(item, index);
+        return this;
+    }
+
+    virtual Sequence<T>* AppendRange(const T* items, int n) override {
+        Heap()->AppendRange(items, n);
+        return this;
+    }
+
+    virtual Sequence<T>* InsertRange(const T* items, int n, int index) override {
+        Heap()->InsertRange(items, n, index);
+        return this;
+    }
+
+    virtual Sequence<T>* RemoveAt(int index) override {
+        return RemoveRange(index, index);
+    }
+
+    virtual Sequence<T>* RemoveRange(int startIndex, int endIndex) override {
+        CheckWritable();
+        if (heap) {
+            heap->RemoveRange(startIndex, endIndex);
+            return this;
+        }
+        if (startIndex < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (endIndex < 0 || startIndex > endIndex || endIndex >= count) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        // Сдвиг внутри частного отображения: трогает только страницы хвоста
+        std::copy(mapped + endIndex + 1, mapped + count, mapped + startIndex);
+        count -= endIndex - startIndex + 1;
+        return this;
+    }
+
+    // Результат выделяется один раз сразу под обе части, отображение копируется одним memcpy
+    virtual Sequence<T>* Concat(const Sequence<T>* seq) const override {
+        int length = GetLength();
+        int otherLength = seq->GetLength();
+        DynamicArray<T, UncheckedPolicy> buffer(length + otherLength);
+        T* dst = buffer.GetData();
+        if (length > 0) {
+            std::memcpy(dst, Data(), static_cast<size_t>(length) * sizeof(T));
+        }
+        const T* src = nullptr;
+        if (const MappedArraySequence<T>* mappedOther = dynamic_cast<const MappedArraySequence<T>*>(seq)) {
+            src = mappedOther->Data();
+        } else if (const ArraySequence<T>* array = dynamic_cast<const ArraySequence<T>*>(seq)) {
+            src = array->GetData();
+        }
+        if (src) {
+            if (otherLength > 0) {
+                std::memcpy(dst + length, src, static_cast<size_t>(otherLength) * sizeof(T));
+            }
+        } else {
+            for (int i = 0; i < otherLength; i++) {
+                dst[length + i] = seq->Get(i);
+            }
+        }
+        return new ArraySequence<T>(std::move(buffer), length + otherLength);
+    }
+
+    virtual const char* TypeName() const override {
+        return "MappedArraySequence";
+    }
+
+    // ReadOnly файл отображается заново, CopyOnWrite копируется в кучу
+    virtual Sequence<T>* Clone() const override {
+        if (mode == MapMode::ReadOnly) {
+            return new MappedArraySequence<T>(path.c_str(), MapMode::ReadOnly);
+        }
+        return new ArraySequence<T>(Data(), GetLength());
+    }
+};
@@ -8,6 +8,7 @@ public:
     T1 first;
     T2 second;
     
+    MonadPair() : first(), second() {}
     MonadPair(T1 a, T2 b) : first(a), second(b) {}
     
     // Монадическая операция bind
@@ -1,13 +1,10 @@
 #pragma once
-#include <vector>
 #include <memory>
-#include <stdexcept>
-#include <functional>
-#include <type_traits>
+#include <tuple>
 #include <string>
 #include <sstream>
 #include <utility>
-#include <cassert>
+#include <cstddef>
 
 // Базовый класс для полиморфизма
 class TupleBase {
@@ -18,159 +15,102 @@ public:
     virtual ~TupleBase() = default;
 };
 
-// Вспомогательный класс для хранения элементов с type erasure
-class TupleElement {
-public:
-    template <typename T>
-    TupleElement(T value) : 
-        data_(new T(std::move(value))),
-        deleter_([](void* ptr) { delete static_cast<T*>(ptr); }),
-        copier_([](void* ptr) -> void* { return new T(*static_cast<T*>(ptr)); }),
-        toString_([](void* ptr) -> std::string { 
-            std::stringstream ss;
-            ss << *static_cast<T*>(ptr);
-            return ss.str();
-        })
-    {}
-    
-    TupleElement(const TupleElement& other) :
-        data_(other.copier_(other.data_)),
-        deleter_(other.deleter_),
-        copier_(other.copier_),
-        toString_(other.toString_)
-    {}
-    
-    TupleElement(TupleElement&& other) noexcept :
-        data_(other.data_),
-        deleter_(std::move(other.deleter_)),
-        copier_(std::move(other.copier_)),
-        toString_(std::move(other.toString_))
-    {
-        other.data_ = nullptr;
+// Реализация кортежа: типы известны на этапе компиляции, значения лежат
+// внутри объекта в std::tuple - ни выделений памяти, ни виртуальных вызовов
+template <typename... Ts>
+class MonadTuple {
+private:
+    std::tuple<Ts...> values;
+
+    template <size_t... Is>
+    std::string toStringImpl(std::index_sequence<Is...>) const {
+        std::stringstream ss;
+        ss << "(";
+        int dummy[] = { 0, ((ss << (Is == 0 ? "" : ", ") << std::get<Is>(values)), 0)... };
+        (void)dummy; // подавляем предупреждение о неиспользуемой переменной
+        ss << ")";
+        return ss.str();
     }
-    
-    TupleElement& operator=(const TupleElement& other) {
-        if (this != &other) {
-            if (deleter_) deleter_(data_);
-            data_ = other.copier_(other.data_);
-            deleter_ = other.deleter_;
-            copier_ = other.copier_;
-            toString_ = other.toString_;
-        }
-        return *this;
+
+public:
+    MonadTuple() : values() {}
+
+    MonadTuple(Ts... items) : values(std::move(items)...) {}
+
+    explicit MonadTuple(const std::tuple<Ts...>& tuple) : values(tuple) {}
+
+    static constexpr size_t size() {
+        return sizeof...(Ts);
     }
-    
-    TupleElement& operator=(TupleElement&& other) noexcept {
-        if (this != &other) {
-            if (deleter_) deleter_(data_);
-            data_ = other.data_;
-            deleter_ = std::move(other.deleter_);
-            copier_ = std::move(other.copier_);
-            toString_ = std::move(other.toString_);
-            other.data_ = nullptr;
-        }
-        return *this;
+
+    // Получение значения по индексу с правильным типом
+    template <size_t I>
+    const typename std::tuple_element<I, std::tuple<Ts...>>::type& get() const {
+        return std::get<I>(values);
     }
-    
-    ~TupleElement() {
-        if (deleter_) deleter_(data_);
+
+    template <size_t I>
+    typename std::tuple_element<I, std::tuple<Ts...>>::type& get() {
+        return std::get<I>(values);
     }
-    
-    template <typename T>
-    T get() const {
-        if (!data_) {
-            throw std::runtime_error("Accessing moved-from TupleElement");
-        }
-        return *static_cast<T*>(data_);
+
+    const std::tuple<Ts...>& ToStdTuple() const {
+        return values;
     }
-    
+
     std::string toString() const {
-        return toString_(data_);
+        return toStringImpl(std::index_sequence_for<Ts...>{});
     }
-    
-    std::unique_ptr<TupleElement> clone() const {
-        return std::unique_ptr<TupleElement>(new TupleElement(*this));
+
+    // Стёртый по типу вид (TupleBase) - создаётся только по запросу
+    std::unique_ptr<TupleBase> Erase() const;
+
+    bool operator==(const MonadTuple& other) const {
+        return values == other.values;
     }
 
-private:
-    void* data_ = nullptr;
-    std::function<void(void*)> deleter_;
-    std::function<void*(void*)> copier_;
-    std::function<std::string(void*)> toString_;
+    bool operator!=(const MonadTuple& other) const {
+        return !(*this == other);
+    }
 };
 
-// Реализация кортежа
 template <typename... Ts>
-class MonadTuple : public TupleBase {
+class ErasedTuple : public TupleBase {
 private:
-    std::vector<TupleElement> elements;
-    
-    // Вспомогательная функция для проверки индекса
-    void check_index(size_t index) const {
-        if (index >= elements.size()) {
-            throw std::out_of_range("Tuple index out of range");
-        }
-    }
+    MonadTuple<Ts...> tuple;
 
 public:
-    MonadTuple(Ts... values) {
-        elements.reserve(sizeof...(Ts));
-        // Используем раскрытие пакета параметров
-        int dummy[] = { (elements.push_back(TupleElement(values)), 0)... };
-        (void)dummy; // подавляем предупреждение о неиспользуемой переменной
-    }
-    
-    MonadTuple(const MonadTuple& other) {
-        elements.reserve(other.elements.size());
-        for (const auto& element : other.elements) {
-            elements.push_back(*element.clone());
-        }
-    }
-    
-    MonadTuple(MonadTuple&& other) noexcept = default;
-    
-    MonadTuple& operator=(const MonadTuple& other) {
-        if (this != &other) {
-            elements.clear();
-            elements.reserve(other.elements.size());
-            for (const auto& element : other.elements) {
-                elements.push_back(*element.clone());
-            }
-        }
-        return *this;
+    explicit ErasedTuple(const MonadTuple<Ts...>& value) : tuple(value) {}
+
+    const MonadTuple<Ts...>& Get() const {
+        return tuple;
     }
-    
-    MonadTuple& operator=(MonadTuple&& other) noexcept = default;
-    
+
     size_t size() const override {
-        return elements.size();
+        return sizeof...(Ts);
     }
-    
-    // Получение значения по индексу с правильным типом
-    template <size_t I>
-    auto get() const {
-        check_index(I);
-        using T = std::tuple_element_t<I, std::tuple<Ts...>>;
-        return elements[I].get<T>();
-    }
-    
+
     std::string toString() const override {
-        std::string result = "(";
-        for (size_t i = 0; i < elements.size(); i++) {
-            if (i > 0) result += ", ";
-            result += elements[i].toString();
-        }
-        result += ")";
-        return result;
+        return tuple.toString();
     }
-    
+
     std::unique_ptr<TupleBase> clone() const override {
-        return std::unique_ptr<MonadTuple<Ts...>>(new MonadTuple<Ts...>(*this));
+        return std::unique_ptr<TupleBase>(new ErasedTuple<Ts...>(tuple));
     }
 };
 
-// Фабрика для создания кортежей
 template <typename... Ts>
-std::shared_ptr<MonadTuple<Ts...>> make_universal_tuple(Ts... args) {
-    return std::shared_ptr<MonadTuple<Ts...>>(new MonadTuple<Ts...>(args...));
-}
\ No newline at end of file
+std::unique_ptr<TupleBase> MonadTuple<Ts...>::Erase() const {
+    return std::unique_ptr<TupleBase>(new ErasedTuple<Ts...>(*this));
+}
+
+template <typename... Ts>
+std::ostream& operator<<(std::ostream& os, const MonadTuple<Ts...>& tuple) {
+    return os << tuple.toString();
+}
+
+// Фабрика для создания кортежей со стёртым типом
+template <typename... Ts>
+std::shared_ptr<TupleBase> make_universal_tuple(Ts... args) {
+    return std::shared_ptr<TupleBase>(new ErasedTuple<Ts...>(MonadTuple<Ts...>(args...)));
+}
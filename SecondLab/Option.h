@@ -1,6 +1,7 @@
 #pragma once
 #include "Exeption.h"
 #include "Error.h"
+#include <functional>
 
 template <typename T>
 class Option {
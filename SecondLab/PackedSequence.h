@@ -0,0 +1,465 @@
+#pragma once
+#include "Sequence.h"
+#include "ArraySequence.h"
+#include "DynamicArray.h"
+#include "Exeption.h"
+#include <cstdint>
+#include <type_traits>
+
+// Последовательность небольших целых (bool, enum, int) в битовых полях
+// по Bits бит. Поля не пересекают границу 64-битного слова: в слове
+// PerWord = 64 / Bits элементов. BitSequence (bool по 1 биту) занимает
+// в 8 раз меньше памяти, чем bool[], PackedSequence<int, 4> - в 8 раз
+// меньше, чем int[].
+//
+// Значение, которое не помещается в поле, вызывает InvalidArg.
+// Знаковые типы хранятся в дополнительном коде и расширяются при чтении.
+// Поля за GetLength() всегда нулевые, поэтому Count/Sum/IndicesOf
+// обрабатывают целое слово за раз без поэлементных проверок.
+template <class T, int Bits>
+class PackedSequence : public Sequence<T> {
+    static_assert(std::is_integral<T>::value || std::is_enum<T>::value, "PackedSequence stores integers");
+    static_assert(Bits >= 1 && Bits <= 32, "Bits must be in [1, 32]");
+
+public:
+    static constexpr int PerWord = 64 / Bits;
+
+    // Ссылка на элемент для operator[]: чтение и запись одного поля
+    class Reference {
+    private:
+        PackedSequence* owner;
+        int index;
+
+    public:
+        Reference(PackedSequence* o, int i) : owner(o), index(i) {}
+
+        operator T() const {
+            return owner->Field(index);
+        }
+
+        Reference& operator=(const T& value) {
+            owner->SetField(index, value);
+            return *this;
+        }
+
+        Reference& operator=(const Reference& other) {
+            return *this = static_cast<T>(other);
+        }
+    };
+
+private:
+    typedef std::uint64_t Word;
+    typedef typename std::conditional<std::is_enum<T>::value, std::underlying_type<T>,
+                                      std::common_type<T>>::type::type Raw;
+
+    static constexpr Word FieldMask = (Word(1) << Bits) - 1;
+    static constexpr Word UsedMask = (PerWord * Bits == 64) ? ~Word(0) : ((Word(1) << (PerWord * Bits)) - 1);
+
+    DynamicArray<Word, UncheckedPolicy> words;
+    int count;
+
+    // Поле со значением pattern в каждой позиции слова
+    static Word Broadcast(Word pattern) {
+        Word result = 0;
+        for (int f = 0; f < PerWord; f++) {
+            result |= pattern << (f * Bits);
+        }
+        return result;
+    }
+
+    // Маска младших fields полей
+    static Word LowFields(int fields) {
+        return fields >= PerWord ? UsedMask : ((Word(1) << (fields * Bits)) - 1);
+    }
+
+    static Word Encode(const T& value) {
+        Word field = static_cast<Word>(static_cast<Raw>(value)) & FieldMask;
+        if (!(Decode(field) == value)) {
+            throw MyException(ErrorType::InvalidArg, -1);
+        }
+        return field;
+    }
+
+    static T Decode(Word field) {
+        if (std::is_signed<Raw>::value && ((field >> (Bits - 1)) & 1)) {
+            field |= ~FieldMask;
+        }
+        return static_cast<T>(static_cast<Raw>(field));
+    }
+
+    T Field(int index) const {
+        Word word = words.GetUnchecked(index / PerWord);
+        return Decode((word >> ((index % PerWord) * Bits)) & FieldMask);
+    }
+
+    void SetField(int index, const T& value) {
+        CheckIndex(index);
+        Store(index, Encode(value));
+    }
+
+    void Store(int index, Word field) {
+        Word& word = words.GetData()[index / PerWord];
+        int shift = (index % PerWord) * Bits;
+        word = (word & ~(FieldMask << shift)) | (field << shift);
+    }
+
+    void CheckIndex(int index) const {
+        if (index < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (index >= count) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+    }
+
+    static int WordsFor(int length) {
+        return (length + PerWord - 1) / PerWord;
+    }
+
+    void Reserve(int length) {
+        int needed = WordsFor(length);
+        if (needed <= words.GetSize()) {
+            return;
+        }
+        int grown = words.GetSize() * 2;
+        words.Resize(grown > needed ? grown : needed);
+    }
+
+    // Сдвигает поля [index, count) на одну позицию вверх; место index обнуляется
+    void ShiftUp(int index) {
+        Word* data = words.GetData();
+        int first = index / PerWord;
+        int last = count / PerWord;
+        Word low = LowFields(index % PerWord);
+        Word carry = 0;
+        for (int w = first; w <= last; w++) {
+            Word word = data[w];
+            Word out = (word >> ((PerWord - 1) * Bits)) & FieldMask;
+            if (w == first) {
+                data[w] = (word & low) | (((word & ~low) << Bits) & UsedMask);
+            } else {
+                data[w] = ((word << Bits) & UsedMask) | carry;
+            }
+            carry = out;
+        }
+    }
+
+    // Сдвигает поля (index, count) на одну позицию вниз; поле count - 1 обнуляется
+    void ShiftDown(int index) {
+        Word* data = words.GetData();
+        int first = index / PerWord;
+        int last = (count - 1) / PerWord;
+        Word low = LowFields(index % PerWord);
+        for (int w = first; w <= last; w++) {
+            Word word = data[w];
+            Word next = (w < last) ? (data[w + 1] & FieldMask) : 0;
+            Word shifted = (word >> Bits) | (next << ((PerWord - 1) * Bits));
+            if (w == first) {
+                data[w] = (word & low) | (shifted & ~low & UsedMask);
+            } else {
+                data[w] = shifted & UsedMask;
+            }
+        }
+    }
+
+    // Слово с единицей в старшем бите каждого поля, равного value
+    static Word MatchFields(Word word, Word pattern) {
+        Word high = Broadcast(Word(1) << (Bits - 1));
+        Word rest = Broadcast(FieldMask >> 1);
+        Word x = word ^ pattern;
+        Word nonZero = (((x & rest) + rest) | x) & high;
+        return ~nonZero & high;
+    }
+
+    // Старшие биты полей [0, count) в слове w
+    Word ValidHighBits(int w) const {
+        int fields = count - w * PerWord;
+        return Broadcast(Word(1) << (Bits - 1)) & LowFields(fields);
+    }
+
+    // Дописывает n элементов src начиная с start; выровненный случай копирует слова целиком
+    void AppendFrom(const PackedSequence& src, int start, int n) {
+        Reserve(count + n);
+        if (count % PerWord == 0 && start % PerWord == 0) {
+            const Word* from = src.words.GetData() + start / PerWord;
+            Word* to = words.GetData() + count / PerWord;
+            int full = n / PerWord;
+            for (int w = 0; w < full; w++) {
+                to[w] = from[w];
+            }
+            int tail = n % PerWord;
+            if (tail) {
+                to[full] = from[full] & LowFields(tail);
+            }
+            count += n;
+            return;
+        }
+        for (int i = 0; i < n; i++) {
+            Store(count + i, (src.words.GetUnchecked((start + i) / PerWord) >> (((start + i) % PerWord) * Bits)) & FieldMask);
+        }
+        count += n;
+    }
+
+public:
+    PackedSequence() : words(1), count(0) {}
+
+    PackedSequence(const T* items, int length) : words(WordsFor(length > 0 ? length : 1)), count(0) {
+        if (length < 0) {
+            throw MyException(ErrorType::NegativeSize, 0);
+        }
+        AppendRange(items, length);
+    }
+
+    PackedSequence(const PackedSequence& other) : words(other.words), count(other.count) {}
+
+    PackedSequence& operator=(const PackedSequence& other) {
+        if (this != &other) {
+            words = other.words;
+            count = other.count;
+        }
+        return *this;
+    }
+
+    Reference operator[](int index) {
+        CheckIndex(index);
+        return Reference(this, index);
+    }
+
+    T operator[](int index) const {
+        return Get(index);
+    }
+
+    void Set(int index, const T& value) {
+        SetField(index, value);
+    }
+
+    virtual T GetFirst() const override {
+        if (count == 0) {
+            throw MyException(ErrorType::OutOfRange, 2);
+        }
+        return Field(0);
+    }
+
+    virtual T GetLast() const override {
+        if (count == 0) {
+            throw MyException(ErrorType::OutOfRange, 2);
+        }
+        return Field(count - 1);
+    }
+
+    virtual T Get(int index) const override {
+        CheckIndex(index);
+        return Field(index);
+    }
+
+    virtual int GetLength() const override {
+        return count;
+    }
+
+    // Байт под элементы (без самого объекта)
+    size_t GetMemory() const {
+        return static_cast<size_t>(words.GetSize()) * sizeof(Word);
+    }
+
+    // Обход по словам: каждое слово читается из памяти один раз
+    template <class F>
+    void ForEach(F f) const {
+        const Word* data = words.GetData();
+        for (int base = 0; base < count; base += PerWord) {
+            Word word = data[base / PerWord];
+            int fields = (count - base < PerWord) ? count - base : PerWord;
+            for (int k = 0; k < fields; k++) {
+                T value = Decode(word & FieldMask);
+                f(static_cast<const T&>(value));
+                word >>= Bits;
+            }
+        }
+    }
+
+    // Обход через Sequence<T>: один проход ForEach вместо n вызовов Get
+    virtual void VisitItems(void (*visit)(const T&, void*), void* context) const override {
+        ForEach([&](const T& item) { visit(item, context); });
+    }
+
+    // Распаковка n элементов начиная с start в out
+    void CopyTo(T* out, int start, int n) const {
+        if (n == 0) {
+            return;
+        }
+        CheckIndex(start);
+        CheckIndex(start + n - 1);
+        for (int i = 0; i < n; i++) {
+            out[i] = Field(start + i);
+        }
+    }
+
+    // Число элементов, равных value: по слову за раз (для BitSequence - popcount)
+    int Count(const T& value) const {
+        Word pattern = Broadcast(Encode(value));
+        const Word* data = words.GetData();
+        int result = 0;
+        for (int w = 0; w < WordsFor(count); w++) {
+            result += __builtin_popcountll(MatchFields(data[w], pattern) & ValidHighBits(w));
+        }
+        return result;
+    }
+
+    // Сумма всех элементов как целых чисел
+    long long Sum() const {
+        const Word* data = words.GetData();
+        long long result = 0;
+        if (Bits == 1 && !std::is_signed<Raw>::value) {
+            for (int w = 0; w < WordsFor(count); w++) {
+                result += __builtin_popcountll(data[w]);
+            }
+            return result;
+        }
+        ForEach([&](const T& value) { result += static_cast<long long>(static_cast<Raw>(value)); });
+        return result;
+    }
+
+    // f(элемент, аккумулятор), как reduce из Functions.h
+    template <class F, class A>
+    A Reduce(F f, A startVal) const {
+        A accum = startVal;
+        ForEach([&](const T& value) { accum = f(value, accum); });
+        return accum;
+    }
+
+    // Позиции элементов, равных value; слова без совпадений пропускаются целиком
+    ArraySequence<int>* IndicesOf(const T& value) const {
+        Word pattern = Broadcast(Encode(value));
+        const Word* data = words.GetData();
+        ArraySequence<int>* result = new ArraySequence<int>();
+        for (int w = 0; w < WordsFor(count); w++) {
+            Word matches = MatchFields(data[w], pattern) & ValidHighBits(w);
+            while (matches) {
+                int bit = __builtin_ctzll(matches);
+                result->Append(w * PerWord + bit / Bits);
+                matches &= matches - 1;
+            }
+        }
+        return result;
+    }
+
+    // Элементы, для которых predicate истинен
+    template <class F>
+    PackedSequence* Where(F predicate) const {
+        PackedSequence* result = new PackedSequence();
+        ForEach([&](const T& value) {
+            if (predicate(value)) {
+                result->Append(value);
+            }
+        });
+        return result;
+    }
+
+    virtual Sequence<T>* GetSubsequence(int startIndex, int endIndex) const override {
+        if (startIndex < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (endIndex < 0 || startIndex > endIndex || endIndex >= count) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        PackedSequence* result = new PackedSequence();
+        result->AppendFrom(*this, startIndex, endIndex - startIndex + 1);
+        return result;
+    }
+
+    virtual Sequence<T>* Append(const T& item) override {
+        Word field = Encode(item);
+        Reserve(count + 1);
+        Store(count, field);
+        count++;
+        return this;
+    }
+
+    virtual Sequence<T>* Prepend(const T& item) override {
+        if (count == 0) {
+            return Append(item);
+        }
+        return InsertAt(item, 0);
+    }
+
+    virtual Sequence<T>* InsertAt(const T& item, int index) override {
+        if (index < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (index >= count) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        Word field = Encode(item);
+        Reserve(count + 1);
+        ShiftUp(index);
+        Store(index, field);
+        count++;
+        return this;
+    }
+
+    virtual Sequence<T>* RemoveAt(int index) override {
+        CheckIndex(index);
+        ShiftDown(index);
+        count--;
+        return this;
+    }
+
+    // Упаковка сразу в слова без промежуточных сдвигов
+    virtual Sequence<T>* AppendRange(const T* items, int n) override {
+        if (n < 0) {
+            throw MyException(ErrorType::NegativeSize, 0);
+        }
+        Reserve(count + n);
+        for (int i = 0; i < n; i++) {
+            Store(count + i, Encode(items[i]));
+        }
+        count += n;
+        return this;
+    }
+
+    virtual Sequence<T>* RemoveRange(int startIndex, int endIndex) override {
+        if (startIndex < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (endIndex < 0 || startIndex > endIndex || endIndex >= count) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        PackedSequence rest;
+        rest.AppendFrom(*this, endIndex + 1, count - endIndex - 1);
+        Word* data = words.GetData();
+        for (int w = startIndex / PerWord; w < words.GetSize(); w++) {
+            data[w] &= (w == startIndex / PerWord) ? LowFields(startIndex % PerWord) : 0;
+        }
+        count = startIndex;
+        AppendFrom(rest, 0, rest.count);
+        return this;
+    }
+
+    virtual Sequence<T>* Concat(const Sequence<T>* seq) const override {
+        PackedSequence* result = new PackedSequence(*this);
+        if (const PackedSequence* other = dynamic_cast<const PackedSequence*>(seq)) {
+            result->AppendFrom(*other, 0, other->count);
+            return result;
+        }
+        for (int i = 0; i < seq->GetLength(); i++) {
+            result->Append(seq->Get(i));
+        }
+        return result;
+    }
+
+    virtual const char* TypeName() const override {
+        return "PackedSequence";
+    }
+
+    virtual Sequence<T>* Clone() const override {
+        return new PackedSequence(*this);
+    }
+};
+
+// Битовый вектор: bool по одному биту
+typedef PackedSequence<bool, 1> BitSequence;
+
+// Для static_map/static_where/static_reduce из StaticFunctions.h
+template <class T, int Bits, class F>
+void static_for_each(const PackedSequence<T, Bits>& seq, F f) {
+    seq.ForEach(f);
+}
@@ -0,0 +1,114 @@
+#pragma once
+#include "ArraySequence.h"
+#include "MonadPair.h"
+#include "ThreadPool.h"
+#include <vector>
+
+// Параллельные версии map/where/reduce/zip над ArraySequence.
+// Входная последовательность делится на куски по grain элементов;
+// если кусок всего один, алгоритм выполняется последовательно.
+
+template <class T, class R>
+Sequence<R>* parallel_map(const ArraySequence<T>* seq, R (*f)(const T&),
+                          int grain = ThreadPool::DefaultGrain) {
+    int n = seq->GetLength();
+    ArraySequence<R>* result = new ArraySequence<R>(n);
+    const T* src = seq->GetData();
+    R* dst = result->GetData();
+    ThreadPool::Default().ParallelFor(0, n, grain, [&](int from, int to) {
+        for (int i = from; i < to; i++) {
+            dst[i] = f(src[i]);
+        }
+    });
+    return result;
+}
+
+// Два прохода: подсчёт подходящих элементов в каждом куске,
+// затем запись по смещениям из префиксной суммы (порядок сохраняется)
+template <class T>
+Sequence<T>* parallel_where(const ArraySequence<T>* seq, bool (*predicate)(const T&),
+                            int grain = ThreadPool::DefaultGrain) {
+    int n = seq->GetLength();
+    if (grain < 1) {
+        grain = 1;
+    }
+    int chunks = ThreadPool::ChunkCount(n, grain);
+    const T* src = seq->GetData();
+    std::vector<unsigned char> flags(n);
+    std::vector<int> offsets(chunks + 1, 0);
+
+    ThreadPool::Default().ParallelFor(0, n, grain, [&](int from, int to) {
+        int matched = 0;
+        for (int i = from; i < to; i++) {
+            flags[i] = predicate(src[i]) ? 1 : 0;
+            matched += flags[i];
+        }
+        offsets[from / grain + 1] = matched;
+    });
+    for (int c = 0; c < chunks; c++) {
+        offsets[c + 1] += offsets[c];
+    }
+
+    ArraySequence<T>* result = new ArraySequence<T>(offsets[chunks]);
+    T* dst = result->GetData();
+    ThreadPool::Default().ParallelFor(0, n, grain, [&](int from, int to) {
+        int out = offsets[from / grain];
+        for (int i = from; i < to; i++) {
+            if (flags[i]) {
+                dst[out++] = src[i];
+            }
+        }
+    });
+    return result;
+}
+
+// Древовидная свёртка. Операция f должна быть ассоциативной;
+// порядок аргументов тот же, что и в последовательном reduce:
+// f(x[n-1], ... f(x[1], f(x[0], startVal)))
+template <class T>
+T parallel_reduce(const ArraySequence<T>* seq, T (*f)(const T&, const T&), T startVal,
+                  int grain = ThreadPool::DefaultGrain) {
+    int n = seq->GetLength();
+    if (n == 0) {
+        return startVal;
+    }
+    if (grain < 1) {
+        grain = 1;
+    }
+    int chunks = ThreadPool::ChunkCount(n, grain);
+    const T* src = seq->GetData();
+    std::vector<T> partial(chunks);
+
+    ThreadPool::Default().ParallelFor(0, n, grain, [&](int from, int to) {
+        T accum = src[from];
+        for (int i = from + 1; i < to; i++) {
+            accum = f(src[i], accum);
+        }
+        partial[from / grain] = accum;
+    });
+
+    for (int step = 1; step < chunks; step *= 2) {
+        for (int left = 0; left + step < chunks; left += 2 * step) {
+            partial[left] = f(partial[left + step], partial[left]);
+        }
+    }
+    return f(partial[0], startVal);
+}
+
+template <class T1, class T2>
+Sequence<MonadPair<T1, T2>>* parallel_zip(const ArraySequence<T1>* s1, const ArraySequence<T2>* s2,
+                                          int grain = ThreadPool::DefaultGrain) {
+    int minLen = (s1->GetLength() < s2->GetLength())
+               ? s1->GetLength()
+               : s2->GetLength();
+    ArraySequence<MonadPair<T1, T2>>* result = new ArraySequence<MonadPair<T1, T2>>(minLen);
+    const T1* a = s1->GetData();
+    const T2* b = s2->GetData();
+    MonadPair<T1, T2>* dst = result->GetData();
+    ThreadPool::Default().ParallelFor(0, minLen, grain, [&](int from, int to) {
+        for (int i = from; i < to; i++) {
+            dst[i] = MonadPair<T1, T2>(a[i], b[i]);
+        }
+    });
+    return result;
+}
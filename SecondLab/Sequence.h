@@ -2,6 +2,7 @@
 #include <stdexcept>
 #include "MonadPair.h"
 #include "MonadTuple.h"
+#include "Exeption.h"
 
 template <class T>
 class Sequence {
@@ -18,6 +19,62 @@ public:
     virtual Sequence<T>* Concat(const Sequence<T>* seq) const = 0;
 
     virtual Sequence<T>* RemoveAt(int index) = 0;
+
+    // Групповые операции. Реализации по умолчанию работают поэлементно;
+    // наследники переопределяют их одним выделением памяти и одним сдвигом.
+    // index в InsertRange может быть равен GetLength() (вставка в конец),
+    // границы RemoveRange включительно, как у GetSubsequence.
+    virtual Sequence<T>* AppendRange(const T* items, int count) {
+        if (count < 0) {
+            throw MyException(ErrorType::NegativeSize, 0);
+        }
+        for (int i = 0; i < count; i++) {
+            Append(items[i]);
+        }
+        return this;
+    }
+
+    virtual Sequence<T>* InsertRange(const T* items, int count, int index) {
+        if (count < 0) {
+            throw MyException(ErrorType::NegativeSize, 0);
+        }
+        if (index < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (index > GetLength()) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        if (index == GetLength()) {
+            return AppendRange(items, count);
+        }
+        for (int i = 0; i < count; i++) {
+            InsertAt(items[i], index + i);
+        }
+        return this;
+    }
+
+    virtual Sequence<T>* RemoveRange(int startIndex, int endIndex) {
+        if (startIndex < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (endIndex < 0 || startIndex > endIndex || endIndex >= GetLength()) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        for (int i = endIndex; i >= startIndex; i--) {
+            RemoveAt(i);
+        }
+        return this;
+    }
+
+    // Обход для кода, которому известен только Sequence<T>: visit(элемент, context)
+    // для каждого элемента по порядку. По умолчанию через Get(i); контейнеры
+    // с собственным ForEach переопределяют его и обходят за один проход.
+    virtual void VisitItems(void (*visit)(const T&, void*), void* context) const {
+        for (int i = 0; i < GetLength(); i++) {
+            visit(Get(i), context);
+        }
+    }
+
     virtual const char* TypeName() const = 0;
 
     virtual Sequence<T>* Clone() const = 0;
@@ -0,0 +1,106 @@
+#pragma once
+#include <atomic>
+#include <ostream>
+
+// Счётчики работы с памятью у контейнеров библиотеки.
+// Включаются флагом компиляции -DSEQUENCE_STATS (make STATS_FLAGS=-DSEQUENCE_STATS).
+// Без него макросы SEQ_STAT_* раскрываются в пустоту, а Snapshot() возвращает нули:
+// в собранном коде не остаётся ни одной лишней инструкции.
+//
+// Копии и перемещения считаются в циклах самой библиотеки (сдвиги, рост
+// буфера, копирование последовательностей), а не внутри конструкторов T.
+// Счётчики общие для всех потоков (relaxed atomic).
+enum class SeqStat {
+    Allocations,     // выделения буферов и узлов
+    Deallocations,
+    BytesAllocated,
+    ElementCopies,
+    ElementMoves,
+    Reallocations,   // переезд буфера при росте
+    NodeHops,        // переходы по указателям next/left/right при поиске позиции
+    Count
+};
+
+struct SequenceStatsSnapshot {
+    long long values[static_cast<int>(SeqStat::Count)];
+
+    long long operator[](SeqStat stat) const {
+        return values[static_cast<int>(stat)];
+    }
+
+    SequenceStatsSnapshot operator-(const SequenceStatsSnapshot& other) const {
+        SequenceStatsSnapshot result;
+        for (int i = 0; i < static_cast<int>(SeqStat::Count); i++) {
+            result.values[i] = values[i] - other.values[i];
+        }
+        return result;
+    }
+};
+
+class SequenceStats {
+private:
+#ifdef SEQUENCE_STATS
+    static std::atomic<long long>* Counters() {
+        static std::atomic<long long> counters[static_cast<int>(SeqStat::Count)];
+        return counters;
+    }
+#endif
+
+public:
+#ifdef SEQUENCE_STATS
+    static constexpr bool Enabled = true;
+#else
+    static constexpr bool Enabled = false;
+#endif
+
+    static void Add(SeqStat stat, long long amount) {
+#ifdef SEQUENCE_STATS
+        Counters()[static_cast<int>(stat)].fetch_add(amount, std::memory_order_relaxed);
+#else
+        (void)stat;
+        (void)amount;
+#endif
+    }
+
+    static SequenceStatsSnapshot Snapshot() {
+        SequenceStatsSnapshot result;
+        for (int i = 0; i < static_cast<int>(SeqStat::Count); i++) {
+#ifdef SEQUENCE_STATS
+            result.values[i] = Counters()[i].load(std::memory_order_relaxed);
+#else
+            result.values[i] = 0;
+#endif
+        }
+        return result;
+    }
+
+    static void Reset() {
+#ifdef SEQUENCE_STATS
+        for (int i = 0; i < static_cast<int>(SeqStat::Count); i++) {
+            Counters()[i].store(0, std::memory_order_relaxed);
+        }
+#endif
+    }
+
+    static const char* Name(SeqStat stat) {
+        static const char* names[] = { "allocations", "deallocations", "bytes_allocated",
+                                       "element_copies", "element_moves", "reallocations", "node_hops" };
+        return names[static_cast<int>(stat)];
+    }
+
+    static void Print(std::ostream& os, const SequenceStatsSnapshot& snapshot) {
+        for (int i = 0; i < static_cast<int>(SeqStat::Count); i++) {
+            os << Name(static_cast<SeqStat>(i)) << '=' << snapshot.values[i]
+               << (i + 1 < static_cast<int>(SeqStat::Count) ? ' ' : '\n');
+        }
+    }
+};
+
+#ifdef SEQUENCE_STATS
+#define SEQ_STAT_ADD(stat, amount) SequenceStats::Add(SeqStat::stat, (amount))
+#define SEQ_STAT_ALLOC(bytes) \
+    (SequenceStats::Add(SeqStat::Allocations, 1), SequenceStats::Add(SeqStat::BytesAllocated, (bytes)))
+#else
+#define SEQ_STAT_ADD(stat, amount) ((void)0)
+#define SEQ_STAT_ALLOC(bytes) ((void)0)
+#endif
@@ -0,0 +1,138 @@
+#pragma once
+#include "ArraySequence.h"
+#include "DynamicArray.h"
+#include "Exeption.h"
+
+// Невладеющий срез непрерывного буфера ArraySequence или DynamicArray.
+// Элементы не копируются: срез хранит только указатель и длину.
+//
+// Время жизни: срез действителен, пока жив источник и пока его буфер
+// не перераспределён. Append/Prepend/InsertAt у ArraySequence и Resize
+// у DynamicArray могут переместить буфер - после них срез надо взять заново.
+// То же относится к первой записи в ArraySequence, чей буфер разделён с копией.
+// Изменение значений через Set у источника видно в срезе.
+template <class T>
+class SequenceView {
+private:
+    const T* data;
+    int length;
+
+    static void CheckRange(int startIndex, int endIndex, int size) {
+        if (startIndex < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (endIndex < 0 || startIndex > endIndex || endIndex >= size) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+    }
+
+public:
+    SequenceView() : data(nullptr), length(0) {}
+
+    SequenceView(const T* items, int count) : data(items), length(count) {
+        if (count < 0) {
+            throw MyException(ErrorType::NegativeSize, 0);
+        }
+    }
+
+    SequenceView(const ArraySequence<T>& seq)
+        : data(seq.GetData()), length(seq.GetLength()) {}
+
+    // Границы включительно, как у GetSubsequence
+    SequenceView(const ArraySequence<T>& seq, int startIndex, int endIndex) {
+        CheckRange(startIndex, endIndex, seq.GetLength());
+        data = seq.GetData() + startIndex;
+        length = endIndex - startIndex + 1;
+    }
+
+    SequenceView(const DynamicArray<T>& arr)
+        : data(arr.GetData()), length(arr.GetSize()) {}
+
+    SequenceView(const DynamicArray<T>& arr, int startIndex, int endIndex) {
+        CheckRange(startIndex, endIndex, arr.GetSize());
+        data = arr.GetData() + startIndex;
+        length = endIndex - startIndex + 1;
+    }
+
+    T GetFirst() const {
+        if (length == 0) {
+            throw MyException(ErrorType::OutOfRange, 2);
+        }
+        return data[0];
+    }
+
+    T GetLast() const {
+        if (length == 0) {
+            throw MyException(ErrorType::OutOfRange, 2);
+        }
+        return data[length - 1];
+    }
+
+    T Get(int index) const {
+        if (index < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (index >= length) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        return data[index];
+    }
+
+    const T& operator[](int index) const {
+        if (index < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (index >= length) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        return data[index];
+    }
+
+    int GetLength() const {
+        return length;
+    }
+
+    const T* GetData() const {
+        return data;
+    }
+
+    const T* begin() const {
+        return data;
+    }
+
+    const T* end() const {
+        return data + length;
+    }
+
+    // Срез среза за O(1), ссылается на тот же источник
+    SequenceView<T> GetSubsequence(int startIndex, int endIndex) const {
+        CheckRange(startIndex, endIndex, length);
+        return SequenceView<T>(data + startIndex, endIndex - startIndex + 1);
+    }
+
+    // Копия среза в собственную последовательность
+    ArraySequence<T>* ToSequence() const {
+        return new ArraySequence<T>(data, length);
+    }
+};
+
+template <class T>
+bool operator==(const SequenceView<T>& a, const SequenceView<T>& b) {
+    if (a.GetLength() != b.GetLength()) return false;
+    for (int i = 0; i < a.GetLength(); ++i)
+        if (!(a.GetData()[i] == b.GetData()[i])) return false;
+    return true;
+}
+
+template <class T>
+bool operator!=(const SequenceView<T>& a, const SequenceView<T>& b) {
+    return !(a == b);
+}
+
+// Для static_map/static_where/static_reduce из StaticFunctions.h
+template <class T, class F>
+void static_for_each(SequenceView<T> view, F f) {
+    for (const T& elem : view) {
+        f(elem);
+    }
+}
@@ -0,0 +1,320 @@
+#pragma once
+#if defined(__SSE2__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// Векторные ядра sum/min/max/count/find для непрерывных буферов int/float/double.
+// Набор инструкций выбирается при компиляции: AVX2 (make SIMD_FLAGS=-mavx2),
+// иначе SSE2 (есть на любом x86-64), иначе скалярный цикл.
+// В каждом ядре несколько независимых аккумуляторов, чтобы не ждать задержку сложения.
+//
+// Сумма float/double складывается в другом порядке, чем последовательный цикл,
+// поэтому может отличаться в последних битах. Порядок min/max с NaN не определён.
+namespace simd {
+
+template <class T> struct IsKernelType { static const bool value = false; };
+template <> struct IsKernelType<int> { static const bool value = true; };
+template <> struct IsKernelType<float> { static const bool value = true; };
+template <> struct IsKernelType<double> { static const bool value = true; };
+
+// Vector<T> описывает регистр: Width элементов, загрузка, операции и маска равенства
+template <class T> struct Vector { static const bool enabled = false; };
+
+#if defined(__AVX2__)
+
+template <> struct Vector<int> {
+    static const bool enabled = true;
+    typedef __m256i V;
+    static const int Width = 8;
+    static V Load(const int* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    static void Store(int* p, V v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+    static V Set1(int x) { return _mm256_set1_epi32(x); }
+    static V Add(V a, V b) { return _mm256_add_epi32(a, b); }
+    static V Min(V a, V b) { return _mm256_min_epi32(a, b); }
+    static V Max(V a, V b) { return _mm256_max_epi32(a, b); }
+    static unsigned EqMask(V a, V b) {
+        return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))));
+    }
+};
+
+template <> struct Vector<float> {
+    static const bool enabled = true;
+    typedef __m256 V;
+    static const int Width = 8;
+    static V Load(const float* p) { return _mm256_loadu_ps(p); }
+    static void Store(float* p, V v) { _mm256_storeu_ps(p, v); }
+    static V Set1(float x) { return _mm256_set1_ps(x); }
+    static V Add(V a, V b) { return _mm256_add_ps(a, b); }
+    static V Min(V a, V b) { return _mm256_min_ps(a, b); }
+    static V Max(V a, V b) { return _mm256_max_ps(a, b); }
+    static unsigned EqMask(V a, V b) {
+        return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)));
+    }
+};
+
+template <> struct Vector<double> {
+    static const bool enabled = true;
+    typedef __m256d V;
+    static const int Width = 4;
+    static V Load(const double* p) { return _mm256_loadu_pd(p); }
+    static void Store(double* p, V v) { _mm256_storeu_pd(p, v); }
+    static V Set1(double x) { return _mm256_set1_pd(x); }
+    static V Add(V a, V b) { return _mm256_add_pd(a, b); }
+    static V Min(V a, V b) { return _mm256_min_pd(a, b); }
+    static V Max(V a, V b) { return _mm256_max_pd(a, b); }
+    static unsigned EqMask(V a, V b) {
+        return static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)));
+    }
+};
+
+#elif defined(__SSE2__)
+
+template <> struct Vector<int> {
+    static const bool enabled = true;
+    typedef __m128i V;
+    static const int Width = 4;
+    static V Load(const int* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    static void Store(int* p, V v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+    static V Set1(int x) { return _mm_set1_epi32(x); }
+    static V Add(V a, V b) { return _mm_add_epi32(a, b); }
+    // В SSE2 нет min/max для 32-битных целых: выбор по маске сравнения
+    static V Min(V a, V b) {
+        V less = _mm_cmplt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(less, a), _mm_andnot_si128(less, b));
+    }
+    static V Max(V a, V b) {
+        V greater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+    }
+    static unsigned EqMask(V a, V b) {
+        return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))));
+    }
+};
+
+template <> struct Vector<float> {
+    static const bool enabled = true;
+    typedef __m128 V;
+    static const int Width = 4;
+    static V Load(const float* p) { return _mm_loadu_ps(p); }
+    static void Store(float* p, V v) { _mm_storeu_ps(p, v); }
+    static V Set1(float x) { return _mm_set1_ps(x); }
+    static V Add(V a, V b) { return _mm_add_ps(a, b); }
+    static V Min(V a, V b) { return _mm_min_ps(a, b); }
+    static V Max(V a, V b) { return _mm_max_ps(a, b); }
+    static unsigned EqMask(V a, V b) {
+        return static_cast<unsigned>(_mm_movemask_ps(_mm_cmpeq_ps(a, b)));
+    }
+};
+
+template <> struct Vector<double> {
+    static const bool enabled = true;
+    typedef __m128d V;
+    static const int Width = 2;
+    static V Load(const double* p) { return _mm_loadu_pd(p); }
+    static void Store(double* p, V v) { _mm_storeu_pd(p, v); }
+    static V Set1(double x) { return _mm_set1_pd(x); }
+    static V Add(V a, V b) { return _mm_add_pd(a, b); }
+    static V Min(V a, V b) { return _mm_min_pd(a, b); }
+    static V Max(V a, V b) { return _mm_max_pd(a, b); }
+    static unsigned EqMask(V a, V b) {
+        return static_cast<unsigned>(_mm_movemask_pd(_mm_cmpeq_pd(a, b)));
+    }
+};
+
+#endif
+
+namespace detail {
+
+template <class T>
+T ScalarSum(const T* data, int n) {
+    T a0 = T(), a1 = T(), a2 = T(), a3 = T();
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        a0 += data[i];
+        a1 += data[i + 1];
+        a2 += data[i + 2];
+        a3 += data[i + 3];
+    }
+    for (; i < n; i++) {
+        a0 += data[i];
+    }
+    return (a0 + a1) + (a2 + a3);
+}
+
+template <class T>
+T ScalarMin(const T* data, int n) {
+    T result = data[0];
+    for (int i = 1; i < n; i++) {
+        result = data[i] < result ? data[i] : result;
+    }
+    return result;
+}
+
+template <class T>
+T ScalarMax(const T* data, int n) {
+    T result = data[0];
+    for (int i = 1; i < n; i++) {
+        result = result < data[i] ? data[i] : result;
+    }
+    return result;
+}
+
+template <class T>
+int ScalarCount(const T* data, int n, T value) {
+    int result = 0;
+    for (int i = 0; i < n; i++) {
+        result += data[i] == value;
+    }
+    return result;
+}
+
+template <class T>
+int ScalarFind(const T* data, int n, T value) {
+    for (int i = 0; i < n; i++) {
+        if (data[i] == value) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Свёртка регистра через память: выполняется один раз на вызов
+template <class T, class Combine>
+T Horizontal(typename Vector<T>::V v, Combine combine) {
+    T lanes[Vector<T>::Width];
+    Vector<T>::Store(lanes, v);
+    T result = lanes[0];
+    for (int i = 1; i < Vector<T>::Width; i++) {
+        result = combine(result, lanes[i]);
+    }
+    return result;
+}
+
+template <class T>
+T VectorSum(const T* data, int n) {
+    typedef Vector<T> Vec;
+    const int W = Vec::Width;
+    typename Vec::V a0 = Vec::Set1(T()), a1 = a0, a2 = a0, a3 = a0;
+    int i = 0;
+    for (; i + 4 * W <= n; i += 4 * W) {
+        a0 = Vec::Add(a0, Vec::Load(data + i));
+        a1 = Vec::Add(a1, Vec::Load(data + i + W));
+        a2 = Vec::Add(a2, Vec::Load(data + i + 2 * W));
+        a3 = Vec::Add(a3, Vec::Load(data + i + 3 * W));
+    }
+    for (; i + W <= n; i += W) {
+        a0 = Vec::Add(a0, Vec::Load(data + i));
+    }
+    a0 = Vec::Add(Vec::Add(a0, a1), Vec::Add(a2, a3));
+    T result = Horizontal<T>(a0, [](T a, T b) { return a + b; });
+    for (; i < n; i++) {
+        result += data[i];
+    }
+    return result;
+}
+
+// IsMax выбирает Max вместо Min; аккумуляторы стартуют с data[0]
+template <class T, bool IsMax>
+T VectorExtreme(const T* data, int n) {
+    typedef Vector<T> Vec;
+    const int W = Vec::Width;
+    auto pick = [](typename Vec::V a, typename Vec::V b) { return IsMax ? Vec::Max(a, b) : Vec::Min(a, b); };
+    typename Vec::V a0 = Vec::Set1(data[0]), a1 = a0, a2 = a0, a3 = a0;
+    int i = 0;
+    for (; i + 4 * W <= n; i += 4 * W) {
+        a0 = pick(a0, Vec::Load(data + i));
+        a1 = pick(a1, Vec::Load(data + i + W));
+        a2 = pick(a2, Vec::Load(data + i + 2 * W));
+        a3 = pick(a3, Vec::Load(data + i + 3 * W));
+    }
+    for (; i + W <= n; i += W) {
+        a0 = pick(a0, Vec::Load(data + i));
+    }
+    a0 = pick(pick(a0, a1), pick(a2, a3));
+    T result = Horizontal<T>(a0, [](T a, T b) { return (IsMax ? a < b : b < a) ? b : a; });
+    for (; i < n; i++) {
+        result = (IsMax ? result < data[i] : data[i] < result) ? data[i] : result;
+    }
+    return result;
+}
+
+template <class T>
+int VectorCount(const T* data, int n, T value) {
+    typedef Vector<T> Vec;
+    const int W = Vec::Width;
+    typename Vec::V needle = Vec::Set1(value);
+    int c0 = 0, c1 = 0;
+    int i = 0;
+    for (; i + 2 * W <= n; i += 2 * W) {
+        c0 += __builtin_popcount(Vec::EqMask(Vec::Load(data + i), needle));
+        c1 += __builtin_popcount(Vec::EqMask(Vec::Load(data + i + W), needle));
+    }
+    return c0 + c1 + ScalarCount(data + i, n - i, value);
+}
+
+template <class T>
+int VectorFind(const T* data, int n, T value) {
+    typedef Vector<T> Vec;
+    const int W = Vec::Width;
+    typename Vec::V needle = Vec::Set1(value);
+    int i = 0;
+    for (; i + W <= n; i += W) {
+        unsigned mask = Vec::EqMask(Vec::Load(data + i), needle);
+        if (mask) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    int tail = ScalarFind(data + i, n - i, value);
+    return tail < 0 ? -1 : i + tail;
+}
+
+} // namespace detail
+
+template <class T>
+T Sum(const T* data, int n) {
+    if constexpr (Vector<T>::enabled) {
+        return detail::VectorSum(data, n);
+    } else {
+        return detail::ScalarSum(data, n);
+    }
+}
+
+// Min/Max требуют n > 0
+template <class T>
+T Min(const T* data, int n) {
+    if constexpr (Vector<T>::enabled) {
+        return detail::VectorExtreme<T, false>(data, n);
+    } else {
+        return detail::ScalarMin(data, n);
+    }
+}
+
+template <class T>
+T Max(const T* data, int n) {
+    if constexpr (Vector<T>::enabled) {
+        return detail::VectorExtreme<T, true>(data, n);
+    } else {
+        return detail::ScalarMax(data, n);
+    }
+}
+
+template <class T>
+int Count(const T* data, int n, T value) {
+    if constexpr (Vector<T>::enabled) {
+        return detail::VectorCount(data, n, value);
+    } else {
+        return detail::ScalarCount(data, n, value);
+    }
+}
+
+// Индекс первого элемента, равного value, или -1
+template <class T>
+int Find(const T* data, int n, T value) {
+    if constexpr (Vector<T>::enabled) {
+        return detail::VectorFind(data, n, value);
+    } else {
+        return detail::ScalarFind(data, n, value);
+    }
+}
+
+} // namespace simd
@@ -0,0 +1,305 @@
+#pragma once
+#include "ArraySequence.h"
+#include "ListSequence.h"
+#include "ImmutableArraySequence.h"
+#include "ImmutableListSequence.h"
+#include "ThreadPool.h"
+#include "Exeption.h"
+#include <functional>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <cstring>
+#include <cstdint>
+#include <vector>
+
+namespace sort_detail {
+
+const int InsertionThreshold = 16;
+
+template <class T, class Compare>
+void InsertionSort(T* data, int lo, int hi, Compare& less) {
+    for (int i = lo + 1; i < hi; i++) {
+        T value = std::move(data[i]);
+        int j = i;
+        while (j > lo && less(value, data[j - 1])) {
+            data[j] = std::move(data[j - 1]);
+            j--;
+        }
+        data[j] = std::move(value);
+    }
+}
+
+template <class T, class Compare>
+void SiftDown(T* data, int lo, int root, int size, Compare& less) {
+    while (true) {
+        int child = 2 * root + 1;
+        if (child >= size) {
+            return;
+        }
+        if (child + 1 < size && less(data[lo + child], data[lo + child + 1])) {
+            child++;
+        }
+        if (!less(data[lo + root], data[lo + child])) {
+            return;
+        }
+        std::swap(data[lo + root], data[lo + child]);
+        root = child;
+    }
+}
+
+template <class T, class Compare>
+void HeapSort(T* data, int lo, int hi, Compare& less) {
+    int size = hi - lo;
+    for (int i = size / 2 - 1; i >= 0; i--) {
+        SiftDown(data, lo, i, size, less);
+    }
+    for (int end = size - 1; end > 0; end--) {
+        std::swap(data[lo], data[lo + end]);
+        SiftDown(data, lo, 0, end, less);
+    }
+}
+
+// Медиана трёх ставится в data[lo]
+template <class T, class Compare>
+void MedianToFront(T* data, int lo, int hi, Compare& less) {
+    int mid = lo + (hi - lo) / 2;
+    int last = hi - 1;
+    if (less(data[mid], data[lo])) std::swap(data[mid], data[lo]);
+    if (less(data[last], data[lo])) std::swap(data[last], data[lo]);
+    if (less(data[last], data[mid])) std::swap(data[last], data[mid]);
+    std::swap(data[lo], data[mid]);
+}
+
+template <class T, class Compare>
+void IntroSortLoop(T* data, int lo, int hi, int depth, Compare& less) {
+    while (hi - lo > InsertionThreshold) {
+        if (depth == 0) {
+            HeapSort(data, lo, hi, less);
+            return;
+        }
+        depth--;
+        MedianToFront(data, lo, hi, less);
+        // Разбиение Хоара, опорный элемент в data[lo]
+        int i = lo;
+        int j = hi;
+        while (true) {
+            do { i++; } while (i < hi && less(data[i], data[lo]));
+            do { j--; } while (less(data[lo], data[j]));
+            if (i >= j) {
+                break;
+            }
+            std::swap(data[i], data[j]);
+        }
+        std::swap(data[lo], data[j]);
+        // Рекурсия по меньшей части, цикл по большей
+        if (j - lo < hi - j - 1) {
+            IntroSortLoop(data, lo, j, depth, less);
+            lo = j + 1;
+        } else {
+            IntroSortLoop(data, j + 1, hi, depth, less);
+            hi = j;
+        }
+    }
+    InsertionSort(data, lo, hi, less);
+}
+
+template <class T, class Compare>
+void IntroSortRange(T* data, int lo, int hi, Compare& less) {
+    int depth = 0;
+    for (int n = hi - lo; n > 1; n >>= 1) {
+        depth += 2;
+    }
+    IntroSortLoop(data, lo, hi, depth, less);
+}
+
+// Устойчивая сортировка: вставками по отрезкам InsertionThreshold, затем
+// слияния снизу вверх через буфер; равные элементы сохраняют порядок
+template <class T, class Compare>
+void StableSortRange(T* data, int lo, int hi, Compare& less) {
+    int n = hi - lo;
+    for (int from = lo; from < hi; from += InsertionThreshold) {
+        InsertionSort(data, from, std::min(from + InsertionThreshold, hi), less);
+    }
+    if (n <= InsertionThreshold) {
+        return;
+    }
+    std::vector<T> buffer(n);
+    T* src = data + lo;
+    T* dst = buffer.data();
+    for (int width = InsertionThreshold; width < n; width *= 2) {
+        for (int left = 0; left < n; left += 2 * width) {
+            int mid = std::min(left + width, n);
+            int right = std::min(left + 2 * width, n);
+            std::merge(std::make_move_iterator(src + left), std::make_move_iterator(src + mid),
+                       std::make_move_iterator(src + mid), std::make_move_iterator(src + right),
+                       dst + left, less);
+        }
+        std::swap(src, dst);
+    }
+    if (src != data + lo) {
+        std::move(src, src + n, data + lo);
+    }
+}
+
+// Ключ, у которого беззнаковый порядок совпадает с порядком исходного типа
+template <class T>
+typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value,
+                        typename std::make_unsigned<T>::type>::type
+RadixKey(T value) {
+    typedef typename std::make_unsigned<T>::type U;
+    return static_cast<U>(value) ^ (U(1) << (sizeof(T) * 8 - 1));
+}
+
+template <class T>
+typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value, T>::type
+RadixKey(T value) {
+    return value;
+}
+
+inline uint32_t RadixKey(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+inline uint64_t RadixKey(double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return (bits & 0x8000000000000000ull) ? ~bits : (bits | 0x8000000000000000ull);
+}
+
+} // namespace sort_detail
+
+// Интроспективная сортировка на месте: быстрая сортировка с медианой трёх,
+// переход на пирамидальную при слишком глубокой рекурсии и сортировка
+// вставками для коротких отрезков
+template <class T, class Compare>
+void IntroSort(ArraySequence<T>* seq, Compare less) {
+    sort_detail::IntroSortRange(seq->GetData(), 0, seq->GetLength(), less);
+}
+
+template <class T>
+void IntroSort(ArraySequence<T>* seq) {
+    IntroSort(seq, std::less<T>());
+}
+
+// Естественная сортировка слиянием списка: узлы перевязываются без копирования элементов
+template <class T, class Compare>
+void MergeSort(ListSequence<T>* seq, Compare less) {
+    seq->Sort(less);
+}
+
+template <class T>
+void MergeSort(ListSequence<T>* seq) {
+    MergeSort(seq, std::less<T>());
+}
+
+// Параллельная сортировка слиянием: куски по grain элементов сортируются
+// интросортом в пуле потоков, затем сливаются попарно уровень за уровнем
+template <class T, class Compare>
+void ParallelMergeSort(ArraySequence<T>* seq, Compare less, int grain = ThreadPool::DefaultGrain) {
+    int n = seq->GetLength();
+    T* data = seq->GetData();
+    if (grain < sort_detail::InsertionThreshold) {
+        grain = sort_detail::InsertionThreshold;
+    }
+    ThreadPool& pool = ThreadPool::Default();
+    pool.ParallelFor(0, n, grain, [&](int from, int to) {
+        sort_detail::IntroSortRange(data, from, to, less);
+    });
+    if (n <= grain) {
+        return;
+    }
+
+    std::vector<T> buffer(n);
+    T* src = data;
+    T* dst = buffer.data();
+    for (int width = grain; width < n; width *= 2) {
+        int pairs = ThreadPool::ChunkCount(n, 2 * width);
+        pool.ParallelFor(0, pairs, 1, [&](int from, int to) {
+            for (int p = from; p < to; p++) {
+                int lo = p * 2 * width;
+                int mid = std::min(lo + width, n);
+                int hi = std::min(lo + 2 * width, n);
+                std::merge(std::make_move_iterator(src + lo), std::make_move_iterator(src + mid),
+                           std::make_move_iterator(src + mid), std::make_move_iterator(src + hi),
+                           dst + lo, less);
+            }
+        });
+        std::swap(src, dst);
+    }
+    if (src != data) {
+        std::move(src, src + n, data);
+    }
+}
+
+template <class T>
+void ParallelMergeSort(ArraySequence<T>* seq, int grain = ThreadPool::DefaultGrain) {
+    ParallelMergeSort(seq, std::less<T>(), grain);
+}
+
+// Поразрядная LSD-сортировка по байтам для целых и вещественных ключей.
+// Проходы, в которых все ключи имеют одинаковый байт, пропускаются.
+template <class T>
+void RadixSort(ArraySequence<T>* seq) {
+    static_assert(std::is_arithmetic<T>::value, "RadixSort requires integral or floating-point keys");
+    int n = seq->GetLength();
+    if (n < 2) {
+        return;
+    }
+    T* data = seq->GetData();
+    std::vector<T> buffer(n);
+    T* src = data;
+    T* dst = buffer.data();
+
+    for (unsigned shift = 0; shift < sizeof(T) * 8; shift += 8) {
+        int histogram[257] = {0};
+        for (int i = 0; i < n; i++) {
+            histogram[((sort_detail::RadixKey(src[i]) >> shift) & 0xFF) + 1]++;
+        }
+        bool trivial = false;
+        for (int b = 1; b <= 256; b++) {
+            if (histogram[b] == n) {
+                trivial = true;
+                break;
+            }
+        }
+        if (trivial) {
+            continue;
+        }
+        for (int b = 0; b < 256; b++) {
+            histogram[b + 1] += histogram[b];
+        }
+        for (int i = 0; i < n; i++) {
+            dst[histogram[(sort_detail::RadixKey(src[i]) >> shift) & 0xFF]++] = src[i];
+        }
+        std::swap(src, dst);
+    }
+    if (src != data) {
+        std::copy(src, src + n, data);
+    }
+}
+
+// Сортировка произвольной последовательности: массив - интросорт,
+// список - сортировка слиянием. Неизменяемые последовательности не сортируются.
+template <class T, class Compare>
+void Sort(Sequence<T>* seq, Compare less) {
+    if (dynamic_cast<ImmutableArraySequence<T>*>(seq) || dynamic_cast<ImmutableListSequence<T>*>(seq)) {
+        throw MyException(ErrorType::SequenceError, 1);
+    }
+    if (auto* array = dynamic_cast<ArraySequence<T>*>(seq)) {
+        IntroSort(array, less);
+        return;
+    }
+    if (auto* list = dynamic_cast<ListSequence<T>*>(seq)) {
+        MergeSort(list, less);
+        return;
+    }
+    throw MyException(ErrorType::SequenceError, 1);
+}
+
+template <class T>
+void Sort(Sequence<T>* seq) {
+    Sort(seq, std::less<T>());
+}
@@ -0,0 +1,339 @@
+#pragma once
+#include "Sequence.h"
+#include "ArraySequence.h"
+#include "Sort.h"
+#include "Exeption.h"
+#include <functional>
+#include <utility>
+
+// Упорядоченная по less последовательность на непрерывном буфере.
+// LowerBound/UpperBound/Contains - двоичный поиск за O(log n) без ветвлений
+// в цикле: шаг выбирается сравнением, а не переходом, и компилятор
+// превращает его в cmov, так что промахов предсказания нет.
+//
+// Порядок задаёт сравнение, поэтому Append/Prepend/InsertAt кладут элемент
+// на его место (индекс только проверяется); равные элементы идут в порядке
+// добавления. AddRange устойчиво сортирует пачку и сливает её с содержимым
+// за O(n + k), равные из пачки встают после уже имеющихся.
+// Merge/Union/Intersection/Difference - линейные слияния двух упорядоченных
+// последовательностей с одинаковым сравнением, как std::set_* для мультимножеств.
+template <class T, class Compare = std::less<T>>
+class SortedSequence : public Sequence<T> {
+private:
+    ArraySequence<T> items;
+    Compare less;
+
+    // Первая позиция, где before(элемент) ложно; before истинно на префиксе
+    template <class Before>
+    int Partition(Before before) const {
+        int n = items.GetLength();
+        if (n == 0) {
+            return 0;
+        }
+        const T* first = items.GetData();
+        const T* base = first;
+        while (n > 1) {
+            int half = n / 2;
+            base += before(base[half]) ? half : 0;
+            n -= half;
+        }
+        return static_cast<int>(base - first) + (before(*base) ? 1 : 0);
+    }
+
+    void CheckInsertIndex(int index) const {
+        if (index < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (index > items.GetLength()) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+    }
+
+    // Дописывает в конец уже упорядоченный кусок
+    void PushSorted(const T* data, int count) {
+        items.AppendRange(data, count);
+    }
+
+public:
+    explicit SortedSequence(Compare compare = Compare()) : less(compare) {}
+
+    SortedSequence(const T* arr, int count, Compare compare = Compare()) : less(compare) {
+        AddRange(arr, count);
+    }
+
+    explicit SortedSequence(const Sequence<T>* seq, Compare compare = Compare()) : less(compare) {
+        ArraySequence<T> copy;
+        for (int i = 0; i < seq->GetLength(); i++) {
+            copy.Append(seq->Get(i));
+        }
+        AddRange(copy.GetData(), copy.GetLength());
+    }
+
+    int LowerBound(const T& value) const {
+        return Partition([&](const T& elem) { return less(elem, value); });
+    }
+
+    int UpperBound(const T& value) const {
+        return Partition([&](const T& elem) { return !less(value, elem); });
+    }
+
+    bool Contains(const T& value) const {
+        int i = LowerBound(value);
+        return i < items.GetLength() && !less(value, items.GetUnchecked(i));
+    }
+
+    // Позиция первого равного value элемента или -1
+    int IndexOf(const T& value) const {
+        int i = LowerBound(value);
+        return (i < items.GetLength() && !less(value, items.GetUnchecked(i))) ? i : -1;
+    }
+
+    int Count(const T& value) const {
+        return UpperBound(value) - LowerBound(value);
+    }
+
+    // Возвращает индекс, на который встал элемент
+    int Add(const T& value) {
+        int index = UpperBound(value);
+        if (index == items.GetLength()) {
+            items.Append(value);
+        } else {
+            items.InsertAt(value, index);
+        }
+        return index;
+    }
+
+    // Пачка сортируется отдельно и сливается с содержимым с конца,
+    // поэтому каждый старый элемент сдвигается не более одного раза
+    void AddRange(const T* values, int count) {
+        if (count < 0) {
+            throw MyException(ErrorType::NegativeSize, 0);
+        }
+        if (count == 0) {
+            return;
+        }
+        ArraySequence<T> batch(values, count);
+        batch.SetCopyOnWrite(false);
+        T* sorted = batch.GetData();
+        sort_detail::StableSortRange(sorted, 0, count, less);
+        int old = items.GetLength();
+        items.AppendRange(sorted, count);
+        T* data = items.GetData();
+        int i = old - 1;
+        int j = count - 1;
+        int k = old + count - 1;
+        while (j >= 0) {
+            if (i >= 0 && less(sorted[j], data[i])) {
+                data[k--] = std::move(data[i--]);
+            } else {
+                data[k--] = std::move(sorted[j--]);
+            }
+        }
+    }
+
+    // Удаляет одно вхождение value; false, если его нет
+    bool Remove(const T& value) {
+        int i = IndexOf(value);
+        if (i < 0) {
+            return false;
+        }
+        items.RemoveAt(i);
+        return true;
+    }
+
+    const T* GetData() const {
+        return items.GetData();
+    }
+
+    template <class F>
+    void ForEach(F f) const {
+        items.ForEach(f);
+    }
+
+    // Обход через Sequence<T>: один проход ForEach вместо n вызовов Get
+    virtual void VisitItems(void (*visit)(const T&, void*), void* context) const override {
+        ForEach([&](const T& item) { visit(item, context); });
+    }
+
+    // Все элементы обеих последовательностей
+    SortedSequence* Merge(const SortedSequence& other) const {
+        SortedSequence* result = new SortedSequence(less);
+        const T* a = items.GetData();
+        const T* b = other.items.GetData();
+        int n = items.GetLength();
+        int m = other.items.GetLength();
+        int i = 0;
+        int j = 0;
+        while (i < n && j < m) {
+            if (less(b[j], a[i])) {
+                result->items.Append(b[j++]);
+            } else {
+                result->items.Append(a[i++]);
+            }
+        }
+        result->PushSorted(a + i, n - i);
+        result->PushSorted(b + j, m - j);
+        return result;
+    }
+
+    // Каждое значение столько раз, сколько в той из последовательностей, где его больше
+    SortedSequence* Union(const SortedSequence& other) const {
+        SortedSequence* result = new SortedSequence(less);
+        const T* a = items.GetData();
+        const T* b = other.items.GetData();
+        int n = items.GetLength();
+        int m = other.items.GetLength();
+        int i = 0;
+        int j = 0;
+        while (i < n && j < m) {
+            if (less(a[i], b[j])) {
+                result->items.Append(a[i++]);
+            } else if (less(b[j], a[i])) {
+                result->items.Append(b[j++]);
+            } else {
+                result->items.Append(a[i++]);
+                j++;
+            }
+        }
+        result->PushSorted(a + i, n - i);
+        result->PushSorted(b + j, m - j);
+        return result;
+    }
+
+    SortedSequence* Intersection(const SortedSequence& other) const {
+        SortedSequence* result = new SortedSequence(less);
+        const T* a = items.GetData();
+        const T* b = other.items.GetData();
+        int n = items.GetLength();
+        int m = other.items.GetLength();
+        int i = 0;
+        int j = 0;
+        while (i < n && j < m) {
+            if (less(a[i], b[j])) {
+                i++;
+            } else if (less(b[j], a[i])) {
+                j++;
+            } else {
+                result->items.Append(a[i++]);
+                j++;
+            }
+        }
+        return result;
+    }
+
+    // Элементы this, которым не нашлось пары в other
+    SortedSequence* Difference(const SortedSequence& other) const {
+        SortedSequence* result = new SortedSequence(less);
+        const T* a = items.GetData();
+        const T* b = other.items.GetData();
+        int n = items.GetLength();
+        int m = other.items.GetLength();
+        int i = 0;
+        int j = 0;
+        while (i < n && j < m) {
+            if (less(a[i], b[j])) {
+                result->items.Append(a[i++]);
+            } else if (less(b[j], a[i])) {
+                j++;
+            } else {
+                i++;
+                j++;
+            }
+        }
+        result->PushSorted(a + i, n - i);
+        return result;
+    }
+
+    virtual T GetFirst() const override {
+        return items.GetFirst();
+    }
+
+    virtual T GetLast() const override {
+        return items.GetLast();
+    }
+
+    virtual T Get(int index) const override {
+        return items.Get(index);
+    }
+
+    virtual int GetLength() const override {
+        return items.GetLength();
+    }
+
+    virtual Sequence<T>* GetSubsequence(int startIndex, int endIndex) const override {
+        if (startIndex < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (endIndex < 0 || startIndex > endIndex || endIndex >= items.GetLength()) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        SortedSequence* result = new SortedSequence(less);
+        result->PushSorted(items.GetData() + startIndex, endIndex - startIndex + 1);
+        return result;
+    }
+
+    virtual Sequence<T>* Append(const T& item) override {
+        Add(item);
+        return this;
+    }
+
+    virtual Sequence<T>* Prepend(const T& item) override {
+        Add(item);
+        return this;
+    }
+
+    virtual Sequence<T>* InsertAt(const T& item, int index) override {
+        CheckInsertIndex(index);
+        Add(item);
+        return this;
+    }
+
+    virtual Sequence<T>* AppendRange(const T* values, int count) override {
+        AddRange(values, count);
+        return this;
+    }
+
+    virtual Sequence<T>* InsertRange(const T* values, int count, int index) override {
+        CheckInsertIndex(index);
+        AddRange(values, count);
+        return this;
+    }
+
+    virtual Sequence<T>* RemoveAt(int index) override {
+        items.RemoveAt(index);
+        return this;
+    }
+
+    virtual Sequence<T>* RemoveRange(int startIndex, int endIndex) override {
+        items.RemoveRange(startIndex, endIndex);
+        return this;
+    }
+
+    // Результат тоже упорядочен: seq любого типа сливается как пачка
+    virtual Sequence<T>* Concat(const Sequence<T>* seq) const override {
+        if (const SortedSequence* other = dynamic_cast<const SortedSequence*>(seq)) {
+            return Merge(*other);
+        }
+        SortedSequence* result = new SortedSequence(*this);
+        ArraySequence<T> batch;
+        for (int i = 0; i < seq->GetLength(); i++) {
+            batch.Append(seq->Get(i));
+        }
+        result->AddRange(batch.GetData(), batch.GetLength());
+        return result;
+    }
+
+    virtual const char* TypeName() const override {
+        return "SortedSequence";
+    }
+
+    virtual Sequence<T>* Clone() const override {
+        return new SortedSequence(*this);
+    }
+};
+
+// Для static_map/static_where/static_reduce из StaticFunctions.h
+template <class T, class C, class F>
+void static_for_each(const SortedSequence<T, C>& seq, F f) {
+    seq.ForEach(f);
+}
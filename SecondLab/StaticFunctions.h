@@ -0,0 +1,66 @@
+#pragma once
+#include "Sequence.h"
+#include "ArraySequence.h"
+#include <utility>
+
+// Статически диспетчеризуемые версии map/where/reduce.
+// Шаблоны принимают конкретный тип последовательности и любой функтор
+// (лямбду), поэтому обход и вызов f встраиваются без vtable и указателей
+// на функции. Перегрузки static_for_each для конкретных контейнеров лежат
+// в их заголовках. Для Sequence<T>& выбирается перегрузка-адаптер:
+// ArraySequence обходится напрямую, остальные - одним виртуальным VisitItems,
+// который каждый контейнер реализует своим ForEach.
+
+template <class T, class F>
+void static_for_each(const Sequence<T>& seq, F f) {
+    if (auto* array = dynamic_cast<const ArraySequence<T>*>(&seq)) {
+        array->ForEach(f);
+        return;
+    }
+    seq.VisitItems([](const T& item, void* context) { (*static_cast<F*>(context))(item); }, &f);
+}
+
+// Тип элемента для последовательностей и срезов
+template <class Seq>
+struct element_of {
+    typedef typename std::decay<decltype(std::declval<const Seq&>().Get(0))>::type type;
+};
+
+template <class Seq, class F>
+auto static_map(const Seq& seq, F f)
+    -> ArraySequence<typename std::decay<decltype(f(std::declval<const typename element_of<Seq>::type&>()))>::type>* {
+    typedef typename element_of<Seq>::type T;
+    typedef typename std::decay<decltype(f(std::declval<const T&>()))>::type R;
+    // Длина берётся один раз: последовательность может расти во время обхода
+    int length = seq.GetLength();
+    ArraySequence<R>* result = new ArraySequence<R>(length);
+    R* dst = result->GetData();
+    int i = 0;
+    static_for_each(seq, [&](const T& elem) {
+        if (i < length) {
+            dst[i++] = f(elem);
+        }
+    });
+    return result;
+}
+
+template <class Seq, class F>
+ArraySequence<typename element_of<Seq>::type>* static_where(const Seq& seq, F predicate) {
+    typedef typename element_of<Seq>::type T;
+    ArraySequence<T>* result = new ArraySequence<T>();
+    static_for_each(seq, [&](const T& elem) {
+        if (predicate(elem)) {
+            result->Append(elem);
+        }
+    });
+    return result;
+}
+
+// Порядок аргументов как у reduce из Functions.h: f(элемент, аккумулятор)
+template <class Seq, class F, class A>
+A static_reduce(const Seq& seq, F f, A startVal) {
+    typedef typename element_of<Seq>::type T;
+    A accum = std::move(startVal);
+    static_for_each(seq, [&](const T& elem) { accum = f(elem, accum); });
+    return accum;
+}
@@ -0,0 +1,227 @@
+#pragma once
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <exception>
+
+// Пул потоков с перехватом задач (work stealing).
+// У каждого рабочего своя очередь: владелец берёт задачи с хвоста,
+// остальные крадут с головы.
+class ThreadPool {
+public:
+    typedef std::function<void()> Task;
+
+    // Размер куска по умолчанию для параллельных алгоритмов
+    static const int DefaultGrain = 4096;
+
+    explicit ThreadPool(int threadCount = 0) : stopping(false), pending(0), nextQueue(0) {
+        if (threadCount <= 0) {
+            threadCount = static_cast<int>(std::thread::hardware_concurrency());
+            if (threadCount <= 0) {
+                threadCount = 1;
+            }
+        }
+        for (int i = 0; i < threadCount; i++) {
+            queues.push_back(std::unique_ptr<WorkerQueue>(new WorkerQueue()));
+        }
+        for (int i = 0; i < threadCount; i++) {
+            workers.push_back(std::thread(&ThreadPool::WorkerLoop, this, i));
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    static ThreadPool& Default() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    int GetThreadCount() const {
+        return static_cast<int>(workers.size());
+    }
+
+    static int ChunkCount(int count, int grain) {
+        if (count <= 0) {
+            return 0;
+        }
+        if (grain < 1) {
+            grain = 1;
+        }
+        return (count + grain - 1) / grain;
+    }
+
+    void Submit(Task task) {
+        int index = CurrentWorker();
+        if (index < 0) {
+            index = static_cast<int>(nextQueue++ % queues.size());
+        }
+        {
+            std::lock_guard<std::mutex> lock(queues[index]->mutex);
+            queues[index]->tasks.push_back(std::move(task));
+        }
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            pending++;
+        }
+        wake.notify_one();
+    }
+
+    // Делит [begin, end) на куски по grain элементов и вызывает body(from, to).
+    // Если кусок один (или поток один), всё выполняется в вызывающем потоке.
+    // Вызывающий поток сам выполняет задачи, пока ждёт, поэтому вложенные
+    // вызовы не приводят к взаимной блокировке.
+    template <class F>
+    void ParallelFor(int begin, int end, int grain, F body) {
+        if (grain < 1) {
+            grain = 1;
+        }
+        int chunks = ChunkCount(end - begin, grain);
+        if (chunks == 0) {
+            return;
+        }
+        if (chunks == 1 || GetThreadCount() == 1) {
+            for (int from = begin; from < end; from += grain) {
+                body(from, (end - from > grain) ? from + grain : end);
+            }
+            return;
+        }
+
+        std::atomic<int> remaining(chunks);
+        std::exception_ptr error;
+        std::mutex errorMutex;
+
+        for (int c = 1; c < chunks; c++) {
+            int from = begin + c * grain;
+            int to = (end - from > grain) ? from + grain : end;
+            Submit([&, from, to]() {
+                try {
+                    body(from, to);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(errorMutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+                remaining--;
+            });
+        }
+
+        try {
+            body(begin, (end - begin > grain) ? begin + grain : end);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+        remaining--;
+
+        while (remaining.load() > 0) {
+            Task task;
+            if (TryTake(CurrentWorker(), task)) {
+                task();
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    struct WorkerQueue {
+        std::deque<Task> tasks;
+        std::mutex mutex;
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> workers;
+    bool stopping;
+    int pending;
+    std::atomic<unsigned> nextQueue;
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+
+    static int& CurrentWorkerSlot() {
+        static thread_local int index = -1;
+        return index;
+    }
+
+    static int CurrentWorker() {
+        return CurrentWorkerSlot();
+    }
+
+    bool PopOwn(int index, Task& task) {
+        std::lock_guard<std::mutex> lock(queues[index]->mutex);
+        if (queues[index]->tasks.empty()) {
+            return false;
+        }
+        task = std::move(queues[index]->tasks.back());
+        queues[index]->tasks.pop_back();
+        return true;
+    }
+
+    bool Steal(int victim, Task& task) {
+        std::lock_guard<std::mutex> lock(queues[victim]->mutex);
+        if (queues[victim]->tasks.empty()) {
+            return false;
+        }
+        task = std::move(queues[victim]->tasks.front());
+        queues[victim]->tasks.pop_front();
+        return true;
+    }
+
+    bool TryTake(int self, Task& task) {
+        bool found = false;
+        if (self >= 0) {
+            found = PopOwn(self, task);
+        }
+        int n = static_cast<int>(queues.size());
+        int start = (self >= 0) ? self + 1 : 0;
+        for (int i = 0; i < n && !found; i++) {
+            int victim = (start + i) % n;
+            if (victim != self) {
+                found = Steal(victim, task);
+            }
+        }
+        if (found) {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            pending--;
+        }
+        return found;
+    }
+
+    void WorkerLoop(int index) {
+        CurrentWorkerSlot() = index;
+        while (true) {
+            Task task;
+            if (TryTake(index, task)) {
+                task();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            wake.wait(lock, [this]() { return stopping || pending > 0; });
+            if (stopping && pending == 0) {
+                return;
+            }
+        }
+    }
+};
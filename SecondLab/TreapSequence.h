@@ -0,0 +1,650 @@
+#pragma once
+#include "Sequence.h"
+#include "Exeption.h"
+#include "SequenceStats.h"
+#include <utility>
+
+// Последовательность на декартовом дереве по неявному ключу.
+// Каждый узел хранит кусок до ChunkCapacity подряд идущих элементов,
+// поэтому дерево в ChunkCapacity раз ниже, а обход идёт по памяти подряд.
+//
+// Get/InsertAt/RemoveAt - O(log n) в среднем.
+// SplitAt/Absorb разрезают и склеивают дерево за O(log n);
+// после склейки куски на стыке сливаются или выравниваются, чтобы
+// правки диапазонами не дробили дерево на куски по 1-2 элемента.
+// GetSubsequence/Concat из интерфейса Sequence константные и копируют
+// результат, собирая его сразу полными кусками: GetSubsequence - O(log n + k),
+// Concat - O(n + k).
+template <class T>
+class TreapSequence : public Sequence<T> {
+public:
+    static const int ChunkCapacity = 64;
+    static const int HalfCapacity = ChunkCapacity / 2;
+
+private:
+    struct Node {
+        T items[ChunkCapacity];
+        int used;
+        int size;
+        unsigned priority;
+        Node* left;
+        Node* right;
+        Node(unsigned p) : used(0), size(0), priority(p), left(nullptr), right(nullptr) {
+            SEQ_STAT_ALLOC(sizeof(Node));
+        }
+        ~Node() {
+            SEQ_STAT_ADD(Deallocations, 1);
+        }
+    };
+
+    Node* root;
+    unsigned seed;
+
+    unsigned NextPriority() {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        return seed;
+    }
+
+    static int Size(const Node* t) {
+        return t ? t->size : 0;
+    }
+
+    static void Update(Node* t) {
+        t->size = t->used + Size(t->left) + Size(t->right);
+    }
+
+    static Node* RotateRight(Node* t) {
+        Node* l = t->left;
+        t->left = l->right;
+        l->right = t;
+        Update(t);
+        Update(l);
+        return l;
+    }
+
+    static Node* RotateLeft(Node* t) {
+        Node* r = t->right;
+        t->right = r->left;
+        r->left = t;
+        Update(t);
+        Update(r);
+        return r;
+    }
+
+    static void InsertIntoChunk(Node* t, int pos, const T& item) {
+        for (int i = t->used; i > pos; i--) {
+            t->items[i] = std::move(t->items[i - 1]);
+        }
+        t->items[pos] = item;
+        t->used++;
+    }
+
+    static Node* Merge(Node* a, Node* b) {
+        if (!a) return b;
+        if (!b) return a;
+        if (a->priority > b->priority) {
+            a->right = Merge(a->right, b);
+            Update(a);
+            return a;
+        }
+        b->left = Merge(a, b->left);
+        Update(b);
+        return b;
+    }
+
+    static void UpdateLeftSpine(Node* t) {
+        if (t) {
+            UpdateLeftSpine(t->left);
+            Update(t);
+        }
+    }
+
+    static void UpdateRightSpine(Node* t) {
+        if (t) {
+            UpdateRightSpine(t->right);
+            Update(t);
+        }
+    }
+
+    // Вынимает самый левый узел дерева t
+    static Node* DetachLeftmost(Node* t, Node*& leftmost) {
+        if (!t->left) {
+            leftmost = t;
+            Node* rest = t->right;
+            t->right = nullptr;
+            return rest;
+        }
+        t->left = DetachLeftmost(t->left, leftmost);
+        Update(t);
+        return t;
+    }
+
+    // Merge, который чинит стык: пока один из соседних кусков меньше половины,
+    // они сливаются в один, если помещаются, иначе делятся поровну
+    static Node* Join(Node* a, Node* b) {
+        if (!a || !b) {
+            return Merge(a, b);
+        }
+        Node* x = a;
+        while (x->right) {
+            x = x->right;
+        }
+        while (b) {
+            Node* y = b;
+            while (y->left) {
+                y = y->left;
+            }
+            if (x->used >= HalfCapacity && y->used >= HalfCapacity) {
+                break;
+            }
+            if (x->used + y->used <= ChunkCapacity) {
+                for (int i = 0; i < y->used; i++) {
+                    x->items[x->used + i] = std::move(y->items[i]);
+                }
+                x->used += y->used;
+                Node* detached;
+                b = DetachLeftmost(b, detached);
+                delete detached;
+                continue;
+            }
+            int total = x->used + y->used;
+            int keep = total / 2;
+            if (x->used > keep) {
+                int moved = x->used - keep;
+                for (int i = y->used - 1; i >= 0; i--) {
+                    y->items[i + moved] = std::move(y->items[i]);
+                }
+                for (int i = 0; i < moved; i++) {
+                    y->items[i] = std::move(x->items[keep + i]);
+                    x->items[keep + i] = T();
+                }
+                y->used += moved;
+            } else {
+                int moved = keep - x->used;
+                for (int i = 0; i < moved; i++) {
+                    x->items[x->used + i] = std::move(y->items[i]);
+                }
+                for (int i = moved; i < y->used; i++) {
+                    y->items[i - moved] = std::move(y->items[i]);
+                }
+                for (int i = y->used - moved; i < y->used; i++) {
+                    y->items[i] = T();
+                }
+                y->used -= moved;
+            }
+            x->used = keep;
+            UpdateLeftSpine(b);
+            break;
+        }
+        UpdateRightSpine(a);
+        return Merge(a, b);
+    }
+
+    // Первые k элементов уходят в a, остальные в b; кусок может быть разрезан
+    void Split(Node* t, int k, Node*& a, Node*& b) {
+        if (!t) {
+            a = b = nullptr;
+            return;
+        }
+        int ls = Size(t->left);
+        if (k <= ls) {
+            Split(t->left, k, a, t->left);
+            Update(t);
+            b = t;
+        } else if (k >= ls + t->used) {
+            Split(t->right, k - ls - t->used, t->right, b);
+            Update(t);
+            a = t;
+        } else {
+            int cut = k - ls;
+            Node* tail = new Node(NextPriority());
+            for (int i = cut; i < t->used; i++) {
+                tail->items[i - cut] = std::move(t->items[i]);
+            }
+            tail->used = t->used - cut;
+            t->used = cut;
+            Update(tail);
+            b = Merge(tail, t->right);
+            t->right = nullptr;
+            Update(t);
+            a = t;
+        }
+    }
+
+    static Node* InsertLeftmost(Node* t, Node* n) {
+        if (!t) {
+            Update(n);
+            return n;
+        }
+        t->left = InsertLeftmost(t->left, n);
+        if (t->left->priority > t->priority) {
+            return RotateRight(t);
+        }
+        Update(t);
+        return t;
+    }
+
+    Node* Insert(Node* t, int index, const T& item) {
+        if (!t) {
+            Node* n = new Node(NextPriority());
+            InsertIntoChunk(n, 0, item);
+            Update(n);
+            return n;
+        }
+        int ls = Size(t->left);
+        if (index < ls) {
+            t->left = Insert(t->left, index, item);
+            if (t->left->priority > t->priority) {
+                return RotateRight(t);
+            }
+        } else if (index <= ls + t->used) {
+            int pos = index - ls;
+            if (t->used < ChunkCapacity) {
+                InsertIntoChunk(t, pos, item);
+            } else {
+                // Кусок полон: в конце заводим новый узел, иначе делим пополам
+                Node* n = new Node(NextPriority());
+                if (pos == t->used) {
+                    InsertIntoChunk(n, 0, item);
+                } else {
+                    int half = ChunkCapacity / 2;
+                    for (int i = half; i < t->used; i++) {
+                        n->items[i - half] = std::move(t->items[i]);
+                    }
+                    n->used = t->used - half;
+                    t->used = half;
+                    if (pos <= half) {
+                        InsertIntoChunk(t, pos, item);
+                    } else {
+                        InsertIntoChunk(n, pos - half, item);
+                    }
+                }
+                t->right = InsertLeftmost(t->right, n);
+                if (t->right->priority > t->priority) {
+                    return RotateLeft(t);
+                }
+            }
+        } else {
+            t->right = Insert(t->right, index - ls - t->used, item);
+            if (t->right->priority > t->priority) {
+                return RotateLeft(t);
+            }
+        }
+        Update(t);
+        return t;
+    }
+
+    static Node* Remove(Node* t, int index) {
+        int ls = Size(t->left);
+        if (index < ls) {
+            t->left = Remove(t->left, index);
+        } else if (index < ls + t->used) {
+            for (int i = index - ls; i < t->used - 1; i++) {
+                t->items[i] = std::move(t->items[i + 1]);
+            }
+            t->used--;
+            t->items[t->used] = T();
+            if (t->used == 0) {
+                Node* rest = Merge(t->left, t->right);
+                delete t;
+                return rest;
+            }
+        } else {
+            t->right = Remove(t->right, index - ls - t->used);
+        }
+        Update(t);
+        return t;
+    }
+
+    const T& At(int index) const {
+        const Node* t = root;
+        while (true) {
+            int ls = Size(t->left);
+            if (index < ls) {
+                t = t->left;
+            } else if (index < ls + t->used) {
+                return t->items[index - ls];
+            } else {
+                index -= ls + t->used;
+                t = t->right;
+            }
+            SEQ_STAT_ADD(NodeHops, 1);
+        }
+    }
+
+    // Складывает элементы по порядку в полные куски отдельного дерева:
+    // спуск по дереву один раз на кусок, а не на каждый элемент
+    struct ChunkBuilder {
+        TreapSequence<T>* owner;
+        Node* tree = nullptr;
+        Node* open = nullptr;
+
+        explicit ChunkBuilder(TreapSequence<T>* owner) : owner(owner) {}
+        ChunkBuilder(const ChunkBuilder&) = delete;
+        ChunkBuilder& operator=(const ChunkBuilder&) = delete;
+
+        void Push(const T& item) {
+            if (!open) {
+                open = new Node(owner->NextPriority());
+            }
+            open->items[open->used] = item;
+            open->used++;
+            if (open->used == ChunkCapacity) {
+                Close();
+            }
+        }
+
+        // Забирает собранное дерево
+        Node* Finish() {
+            Close();
+            Node* result = tree;
+            tree = nullptr;
+            return result;
+        }
+
+        ~ChunkBuilder() {
+            delete open;
+            Destroy(tree);
+        }
+
+    private:
+        void Close() {
+            if (open) {
+                Update(open);
+                tree = Merge(tree, open);
+                open = nullptr;
+            }
+        }
+    };
+
+    // Добавляет элементы с позициями [from, to) поддерева t в builder
+    static void CopyRange(const Node* t, int from, int to, ChunkBuilder& builder) {
+        if (!t || from >= to) {
+            return;
+        }
+        int ls = Size(t->left);
+        if (from < ls) {
+            CopyRange(t->left, from, to, builder);
+        }
+        int begin = (from > ls) ? from - ls : 0;
+        int end = (to - ls < t->used) ? to - ls : t->used;
+        for (int i = begin; i < end; i++) {
+            builder.Push(t->items[i]);
+        }
+        if (to > ls + t->used) {
+            int shift = ls + t->used;
+            CopyRange(t->right, (from > shift) ? from - shift : 0, to - shift, builder);
+        }
+    }
+
+    template <class F>
+    static void Visit(const Node* t, F& f) {
+        if (!t) {
+            return;
+        }
+        Visit(t->left, f);
+        for (int i = 0; i < t->used; i++) {
+            f(static_cast<const T&>(t->items[i]));
+        }
+        Visit(t->right, f);
+    }
+
+    static int CountChunks(const Node* t) {
+        return t ? 1 + CountChunks(t->left) + CountChunks(t->right) : 0;
+    }
+
+    static Node* CopyTree(const Node* t) {
+        if (!t) {
+            return nullptr;
+        }
+        Node* n = new Node(t->priority);
+        for (int i = 0; i < t->used; i++) {
+            n->items[i] = t->items[i];
+        }
+        n->used = t->used;
+        n->size = t->size;
+        n->left = CopyTree(t->left);
+        n->right = CopyTree(t->right);
+        return n;
+    }
+
+    static void Destroy(Node* t) {
+        if (!t) {
+            return;
+        }
+        Destroy(t->left);
+        Destroy(t->right);
+        delete t;
+    }
+
+    void CheckIndex(int index) const {
+        if (index < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (index >= Size(root)) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+    }
+
+public:
+    TreapSequence() : root(nullptr), seed(2463534242u) {}
+
+    TreapSequence(const T* arr, int count) : TreapSequence() {
+        if (count < 0) {
+            throw MyException(ErrorType::NegativeSize, 0);
+        }
+        for (int i = 0; i < count; i++) {
+            Append(arr[i]);
+        }
+    }
+
+    TreapSequence(const TreapSequence<T>& other) : root(CopyTree(other.root)), seed(other.seed) {}
+
+    TreapSequence<T>& operator=(const TreapSequence<T>& other) {
+        if (this != &other) {
+            Node* copy = CopyTree(other.root);
+            Destroy(root);
+            root = copy;
+            seed = other.seed;
+        }
+        return *this;
+    }
+
+    virtual ~TreapSequence() {
+        Destroy(root);
+    }
+
+    virtual T GetFirst() const override {
+        if (!root) {
+            throw MyException(ErrorType::OutOfRange, 2);
+        }
+        return At(0);
+    }
+
+    virtual T GetLast() const override {
+        if (!root) {
+            throw MyException(ErrorType::OutOfRange, 2);
+        }
+        return At(Size(root) - 1);
+    }
+
+    virtual T Get(int index) const override {
+        CheckIndex(index);
+        return At(index);
+    }
+
+    virtual int GetLength() const override {
+        return Size(root);
+    }
+
+    virtual Sequence<T>* GetSubsequence(int startIndex, int endIndex) const override {
+        if (startIndex < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (endIndex < 0 || startIndex > endIndex || endIndex >= Size(root)) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        TreapSequence<T>* result = new TreapSequence<T>();
+        try {
+            ChunkBuilder builder(result);
+            CopyRange(root, startIndex, endIndex + 1, builder);
+            result->root = builder.Finish();
+        } catch (...) {
+            delete result;
+            throw;
+        }
+        return result;
+    }
+
+    virtual Sequence<T>* Append(const T& item) override {
+        root = Insert(root, Size(root), item);
+        return this;
+    }
+
+    virtual Sequence<T>* Prepend(const T& item) override {
+        root = Insert(root, 0, item);
+        return this;
+    }
+
+    virtual Sequence<T>* InsertAt(const T& item, int index) override {
+        CheckIndex(index);
+        root = Insert(root, index, item);
+        return this;
+    }
+
+    virtual Sequence<T>* RemoveAt(int index) override {
+        if (index < 0 || index >= Size(root)) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        root = Remove(root, index);
+        return this;
+    }
+
+    virtual Sequence<T>* AppendRange(const T* items, int count) override {
+        return InsertRange(items, count, Size(root));
+    }
+
+    // Новые элементы собираются в полные куски отдельным деревом
+    // и вклеиваются двумя слияниями: O(log n + k)
+    virtual Sequence<T>* InsertRange(const T* items, int count, int index) override {
+        if (count < 0) {
+            throw MyException(ErrorType::NegativeSize, 0);
+        }
+        if (index < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (index > Size(root)) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        Node* middle = nullptr;
+        for (int from = 0; from < count; from += ChunkCapacity) {
+            Node* n = new Node(NextPriority());
+            int to = (count - from > ChunkCapacity) ? from + ChunkCapacity : count;
+            for (int i = from; i < to; i++) {
+                n->items[i - from] = items[i];
+            }
+            n->used = to - from;
+            Update(n);
+            middle = Merge(middle, n);
+        }
+        Node* left = nullptr;
+        Node* right = nullptr;
+        Split(root, index, left, right);
+        root = Join(Join(left, middle), right);
+        return this;
+    }
+
+    virtual Sequence<T>* RemoveRange(int startIndex, int endIndex) override {
+        if (startIndex < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (endIndex < 0 || startIndex > endIndex || endIndex >= Size(root)) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        Node* left = nullptr;
+        Node* rest = nullptr;
+        Node* middle = nullptr;
+        Node* right = nullptr;
+        Split(root, startIndex, left, rest);
+        Split(rest, endIndex - startIndex + 1, middle, right);
+        Destroy(middle);
+        root = Join(left, right);
+        return this;
+    }
+
+    virtual Sequence<T>* Concat(const Sequence<T>* seq) const override {
+        TreapSequence<T>* result = new TreapSequence<T>(*this);
+        if (const TreapSequence<T>* other = dynamic_cast<const TreapSequence<T>*>(seq)) {
+            result->root = Join(result->root, CopyTree(other->root));
+            return result;
+        }
+        try {
+            ChunkBuilder builder(result);
+            seq->VisitItems([](const T& item, void* context) {
+                static_cast<ChunkBuilder*>(context)->Push(item);
+            }, &builder);
+            result->root = Join(result->root, builder.Finish());
+        } catch (...) {
+            delete result;
+            throw;
+        }
+        return result;
+    }
+
+    // Число узлов-кусков: для проверки заполненности
+    int GetChunkCount() const {
+        return CountChunks(root);
+    }
+
+    // Обход по кускам за O(n) вместо n спусков Get
+    template <class F>
+    void ForEach(F f) const {
+        Visit(root, f);
+    }
+
+    // Обход через Sequence<T>: один проход ForEach вместо n вызовов Get
+    virtual void VisitItems(void (*visit)(const T&, void*), void* context) const override {
+        ForEach([&](const T& item) { visit(item, context); });
+    }
+
+    // Отрезает элементы [index, GetLength()) в новую последовательность за O(log n)
+    TreapSequence<T>* SplitAt(int index) {
+        if (index < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (index > Size(root)) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        TreapSequence<T>* tail = new TreapSequence<T>();
+        tail->seed = NextPriority() | 1u;
+        Split(root, index, root, tail->root);
+        return tail;
+    }
+
+    // Забирает все узлы other в конец этой последовательности за O(log n);
+    // other становится пустой
+    TreapSequence<T>* Absorb(TreapSequence<T>* other) {
+        if (other == this) {
+            throw MyException(ErrorType::SequenceError, 1);
+        }
+        root = Join(root, other->root);
+        other->root = nullptr;
+        return this;
+    }
+
+    virtual const char* TypeName() const override {
+        return "TreapSequence";
+    }
+
+    virtual Sequence<T>* Clone() const override {
+        return new TreapSequence<T>(*this);
+    }
+};
+
+// Для static_map/static_where/static_reduce из StaticFunctions.h
+template <class T, class F>
+void static_for_each(const TreapSequence<T>& seq, F f) {
+    seq.ForEach(f);
+}
@@ -4,7 +4,16 @@
 #include <memory>
 #include <functional>
 #include <sstream>
+#include <fstream>
 #include <utility>
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <stdexcept>
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
 
 #include "Sequence.h"
 #include "ArraySequence.h"
@@ -17,6 +26,7 @@
 #include "Functions.h"
 #include "Option.h"
 #include "MonadTuple.h"
+#include "SequenceStats.h"
 
 using namespace std;
 
@@ -132,6 +142,9 @@ void runUI() {
                  << "Choose: ";
 
             auto cmdOption = readInt("");
+            if (cmdOption.IsNone() && cin.eof()) {
+                break;
+            }
             if (cmdOption.IsNone()) {
                 cout << "[Error] Invalid input\n";
                 continue;
@@ -413,8 +426,11 @@ static void handleRemoveItem(vector<shared_ptr<SequenceBase>>& seqs) {
         return;
     }
 
+    // Изменяемые последовательности возвращают себя: новая обёртка удалила бы их второй раз
     Sequence<int>* newSeq = wrapper->get()->RemoveAt(idxOption.Unwrap());
-    seqs[id] = make_shared<SequenceWrapper<int>>(newSeq);
+    if (newSeq != wrapper->get()) {
+        seqs[id] = make_shared<SequenceWrapper<int>>(newSeq);
+    }
     cout << "[OK] Removed item at index " << idxOption.Unwrap() 
          << " from seq #" << id << "\n";
 }
@@ -538,4 +554,268 @@ static void handleUnzipTuple(vector<shared_ptr<SequenceBase>>& seqs) {
     else {
         cout << "[Error] Unsupported tuple sequence type\n";
     }
-}
\ No newline at end of file
+}
+
+// ==== Пакетный режим ====
+// Скрипт - по команде в строке, после # комментарий. Последовательности
+// нумеруются так же, как в меню (ID - порядок создания).
+//
+//   create array|list|iarray|ilist    новая пустая последовательность int
+//   random <id> <n> [seed]            дописать n случайных чисел из [-1000, 1000]
+//   append <id> <value>
+//   remove <id> <index>
+//   sub <id> <start> <end>            подпоследовательность как новый ID
+//   concat <id1> <id2>
+//   map <id> square|double|negate
+//   where <id> even|odd|positive
+//   reduce <id> sum|min|max
+//   zip <id1> <id2> / unzip <id>
+//   print [<id>] / drop <id>
+//
+// После каждой команды печатается время, текущий и пиковый RSS процесса,
+// а при сборке с -DSEQUENCE_STATS - число выделений памяти.
+
+static int squareOp(const int& x) { return x * x; }
+static int doubleOp(const int& x) { return x * 2; }
+static int negateOp(const int& x) { return -x; }
+static bool isEven(const int& x) { return x % 2 == 0; }
+static bool isOdd(const int& x) { return x % 2 != 0; }
+static bool isPositive(const int& x) { return x > 0; }
+
+// Текущий RSS в КиБ или -1, если ОС его не сообщает
+static long currentRssKb() {
+#if defined(__linux__)
+    ifstream statm("/proc/self/statm");
+    long pages = 0, resident = 0;
+    if (statm >> pages >> resident) {
+        return resident * (sysconf(_SC_PAGESIZE) / 1024);
+    }
+#endif
+    return -1;
+}
+
+static long peakRssKb() {
+#if defined(__unix__) || defined(__APPLE__)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#if defined(__APPLE__)
+        return usage.ru_maxrss / 1024;
+#else
+        return usage.ru_maxrss;
+#endif
+    }
+#endif
+    return -1;
+}
+
+static string formatKb(long kb) {
+    if (kb < 0) return "n/a";
+    ostringstream out;
+    out << fixed << setprecision(1) << kb / 1024.0 << " MiB";
+    return out.str();
+}
+
+static int scriptInt(istringstream& args, const char* what) {
+    int value;
+    if (!(args >> value)) {
+        throw runtime_error(string("expected ") + what);
+    }
+    return value;
+}
+
+static SequenceWrapper<int>* scriptSequence(vector<shared_ptr<SequenceBase>>& seqs, istringstream& args) {
+    int id = scriptInt(args, "sequence ID");
+    if (id < 0 || id >= static_cast<int>(seqs.size())) {
+        throw runtime_error("invalid sequence ID " + to_string(id));
+    }
+    auto wrapper = dynamic_cast<SequenceWrapper<int>*>(seqs[id].get());
+    if (!wrapper) {
+        throw runtime_error("sequence " + to_string(id) + " must contain integers");
+    }
+    return wrapper;
+}
+
+// Неизменяемые последовательности возвращают новый объект - он заменяет старый
+static string scriptReplace(vector<shared_ptr<SequenceBase>>& seqs, SequenceWrapper<int>* wrapper, Sequence<int>* result) {
+    string length = "len=" + to_string(result->GetLength());
+    if (result == wrapper->get()) return length;
+    for (auto& seq : seqs) {
+        if (seq.get() == wrapper) {
+            seq = make_shared<SequenceWrapper<int>>(result);
+            break;
+        }
+    }
+    return length;
+}
+
+static string scriptAdd(vector<shared_ptr<SequenceBase>>& seqs, shared_ptr<SequenceBase> seq) {
+    seqs.push_back(seq);
+    return "ID=" + to_string(seqs.size() - 1);
+}
+
+// Выполняет одну команду; возвращает краткий результат для отчёта
+static string runScriptCommand(vector<shared_ptr<SequenceBase>>& seqs, const string& cmd, istringstream& args) {
+    if (cmd == "create") {
+        string type;
+        args >> type;
+        Sequence<int>* seq = nullptr;
+        if (type == "array") seq = new ArraySequence<int>();
+        else if (type == "list") seq = new ListSequence<int>();
+        else if (type == "iarray") seq = new ImmutableArraySequence<int>();
+        else if (type == "ilist") seq = new ImmutableListSequence<int>();
+        else throw runtime_error("unknown sequence type '" + type + "'");
+        return scriptAdd(seqs, make_shared<SequenceWrapper<int>>(seq));
+    }
+    if (cmd == "random") {
+        auto wrapper = scriptSequence(seqs, args);
+        int n = scriptInt(args, "count");
+        if (n < 0) throw runtime_error("negative count");
+        unsigned seed = 1;
+        args >> seed;
+        mt19937 rng(seed);
+        uniform_int_distribution<int> value(-1000, 1000);
+        vector<int> items(static_cast<size_t>(n));
+        for (int& item : items) item = value(rng);
+        return scriptReplace(seqs, wrapper, wrapper->get()->AppendRange(items.data(), n));
+    }
+    if (cmd == "append") {
+        auto wrapper = scriptSequence(seqs, args);
+        int value = scriptInt(args, "value");
+        return scriptReplace(seqs, wrapper, wrapper->get()->Append(value));
+    }
+    if (cmd == "remove") {
+        auto wrapper = scriptSequence(seqs, args);
+        int index = scriptInt(args, "index");
+        return scriptReplace(seqs, wrapper, wrapper->get()->RemoveAt(index));
+    }
+    if (cmd == "sub") {
+        auto wrapper = scriptSequence(seqs, args);
+        int start = scriptInt(args, "start index");
+        int end = scriptInt(args, "end index");
+        return scriptAdd(seqs, make_shared<SequenceWrapper<int>>(wrapper->get()->GetSubsequence(start, end)));
+    }
+    if (cmd == "concat") {
+        auto first = scriptSequence(seqs, args);
+        auto second = scriptSequence(seqs, args);
+        return scriptAdd(seqs, make_shared<SequenceWrapper<int>>(first->get()->Concat(second->get())));
+    }
+    if (cmd == "map") {
+        auto wrapper = scriptSequence(seqs, args);
+        string op;
+        args >> op;
+        int (*f)(const int&) = op == "square" ? squareOp : op == "double" ? doubleOp : op == "negate" ? negateOp : nullptr;
+        if (!f) throw runtime_error("unknown map operation '" + op + "'");
+        return scriptAdd(seqs, make_shared<SequenceWrapper<int>>(map(static_cast<const Sequence<int>*>(wrapper->get()), f)));
+    }
+    if (cmd == "where") {
+        auto wrapper = scriptSequence(seqs, args);
+        string op;
+        args >> op;
+        bool (*f)(const int&) = op == "even" ? isEven : op == "odd" ? isOdd : op == "positive" ? isPositive : nullptr;
+        if (!f) throw runtime_error("unknown predicate '" + op + "'");
+        return scriptAdd(seqs, make_shared<SequenceWrapper<int>>(where(static_cast<const Sequence<int>*>(wrapper->get()), f)));
+    }
+    if (cmd == "reduce") {
+        auto wrapper = scriptSequence(seqs, args);
+        const Sequence<int>* seq = wrapper->get();
+        string op;
+        args >> op;
+        int result;
+        if (op == "sum") result = reduce(seq, SumOp<int>, 0);
+        else if (op == "min") result = reduce(seq, MinOp<int>, seq->GetFirst());
+        else if (op == "max") result = reduce(seq, MaxOp<int>, seq->GetFirst());
+        else throw runtime_error("unknown reduce operation '" + op + "'");
+        return "result=" + to_string(result);
+    }
+    if (cmd == "zip") {
+        auto first = scriptSequence(seqs, args);
+        auto second = scriptSequence(seqs, args);
+        auto* zipped = zip<int, int>(first->get(), second->get());
+        return scriptAdd(seqs, make_shared<SequenceWrapper<MonadPair<int, int>>>(zipped));
+    }
+    if (cmd == "unzip") {
+        int id = scriptInt(args, "sequence ID");
+        if (id < 0 || id >= static_cast<int>(seqs.size())) {
+            throw runtime_error("invalid sequence ID " + to_string(id));
+        }
+        auto wrapper = dynamic_cast<SequenceWrapper<MonadPair<int, int>>*>(seqs[id].get());
+        if (!wrapper) throw runtime_error("not a pair sequence");
+        auto res = unzip<int, int>(wrapper->get());
+        string first = scriptAdd(seqs, make_shared<SequenceWrapper<int>>(res.first));
+        return first + ", " + scriptAdd(seqs, make_shared<SequenceWrapper<int>>(res.second));
+    }
+    if (cmd == "print") {
+        int id;
+        if (args >> id) {
+            if (id < 0 || id >= static_cast<int>(seqs.size())) {
+                throw runtime_error("invalid sequence ID " + to_string(id));
+            }
+            seqs[id]->Print();
+        } else {
+            handlePrintAll(seqs);
+        }
+        return "ok";
+    }
+    if (cmd == "drop") {
+        int id = scriptInt(args, "sequence ID");
+        if (id < 0 || id >= static_cast<int>(seqs.size())) {
+            throw runtime_error("invalid sequence ID " + to_string(id));
+        }
+        seqs.erase(seqs.begin() + id);
+        return "ok";
+    }
+    throw runtime_error("unknown command '" + cmd + "'");
+}
+
+int runScript(const char* path) {
+    ifstream script(path);
+    if (!script) {
+        cerr << "[Error] Cannot open script " << path << "\n";
+        return 1;
+    }
+    vector<shared_ptr<SequenceBase>> seqs;
+    string line;
+    int lineNo = 0;
+    int errors = 0;
+    double totalMs = 0.0;
+    while (getline(script, line)) {
+        lineNo++;
+        size_t comment = line.find('#');
+        if (comment != string::npos) line.erase(comment);
+        line.erase(line.find_last_not_of(" \t\r") + 1);
+        istringstream args(line);
+        string cmd;
+        if (!(args >> cmd)) continue;
+
+        long rssBefore = currentRssKb();
+        SequenceStatsSnapshot statsBefore = SequenceStats::Snapshot();
+        auto start = chrono::steady_clock::now();
+        string result;
+        try {
+            result = runScriptCommand(seqs, cmd, args);
+        }
+        catch (const exception& ex) {
+            result = string("error: ") + ex.what();
+            errors++;
+        }
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        totalMs += ms;
+        long rssAfter = currentRssKb();
+
+        cout << "[" << lineNo << "] " << line.substr(line.find_first_not_of(" \t")) << " -> " << result
+             << " | " << fixed << setprecision(3) << ms << " ms"
+             << " | rss " << formatKb(rssAfter);
+        if (rssBefore >= 0 && rssAfter >= 0) {
+            cout << " (" << showpos << (rssAfter - rssBefore) << noshowpos << " KiB)";
+        }
+        cout << " | peak " << formatKb(peakRssKb());
+        if (SequenceStats::Enabled) {
+            SequenceStatsSnapshot diff = SequenceStats::Snapshot() - statsBefore;
+            cout << " | allocs " << diff[SeqStat::Allocations];
+        }
+        cout << "\n";
+    }
+    cout << "[Done] " << lineNo << " lines, " << errors << " errors, "
+         << fixed << setprecision(3) << totalMs << " ms total, peak " << formatKb(peakRssKb()) << "\n";
+    return errors ? 1 : 0;
+}
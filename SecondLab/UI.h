@@ -1,3 +1,6 @@
 #pragma once
 
-void runUI();
\ No newline at end of file
+void runUI();
+
+// Пакетный режим: команды из файла, время и память по каждой; 0 - без ошибок
+int runScript(const char* path);
\ No newline at end of file
@@ -0,0 +1,234 @@
+#pragma once
+#include "Sequence.h"
+#include "ArraySequence.h"
+#include "SequenceView.h"
+#include "MonadTuple.h"
+#include "Exeption.h"
+#include <tuple>
+#include <utility>
+
+// Колоночное (structure-of-arrays) хранение результата zip:
+// каждая входная последовательность лежит отдельным непрерывным столбцом,
+// строка MonadTuple собирается только при обращении к ней.
+// Столбцы можно читать напрямую (Column/ColumnView) или забрать за O(1) (Unzip).
+template <typename... Ts>
+class ZippedSequence : public Sequence<MonadTuple<Ts...>> {
+private:
+    typedef MonadTuple<Ts...> Row;
+    typedef std::index_sequence_for<Ts...> Indices;
+
+    std::tuple<ArraySequence<Ts>*...> columns;
+
+    int Length() const {
+        return std::get<0>(columns)->GetLength();
+    }
+
+    template <size_t... Is>
+    Row RowAt(int index, std::index_sequence<Is...>) const {
+        return Row(std::get<Is>(columns)->GetData()[index]...);
+    }
+
+    template <size_t... Is>
+    void AppendRow(const Row& row, std::index_sequence<Is...>) {
+        (std::get<Is>(columns)->Append(row.template get<Is>()), ...);
+    }
+
+    template <size_t... Is>
+    void PrependRow(const Row& row, std::index_sequence<Is...>) {
+        (std::get<Is>(columns)->Prepend(row.template get<Is>()), ...);
+    }
+
+    template <size_t... Is>
+    void InsertRow(const Row& row, int index, std::index_sequence<Is...>) {
+        (std::get<Is>(columns)->InsertAt(row.template get<Is>(), index), ...);
+    }
+
+    template <size_t... Is>
+    void RemoveRow(int index, std::index_sequence<Is...>) {
+        (std::get<Is>(columns)->RemoveAt(index), ...);
+    }
+
+    template <size_t... Is>
+    void DeleteColumns(std::index_sequence<Is...>) {
+        (delete std::get<Is>(columns), ...);
+    }
+
+    template <size_t... Is>
+    static std::tuple<ArraySequence<Ts>*...> CopyColumns(const std::tuple<ArraySequence<Ts>*...>& src,
+                                                          std::index_sequence<Is...>) {
+        return std::tuple<ArraySequence<Ts>*...>(new ArraySequence<Ts>(*std::get<Is>(src))...);
+    }
+
+    template <class T>
+    static ArraySequence<T>* MakeColumn(const Sequence<T>* seq, int length) {
+        ArraySequence<T>* column = new ArraySequence<T>(length);
+        T* dst = column->GetData();
+        if (const ArraySequence<T>* array = dynamic_cast<const ArraySequence<T>*>(seq)) {
+            const T* src = array->GetData();
+            for (int i = 0; i < length; i++) {
+                dst[i] = src[i];
+            }
+        } else {
+            for (int i = 0; i < length; i++) {
+                dst[i] = seq->Get(i);
+            }
+        }
+        return column;
+    }
+
+    static int MinLength(const Sequence<Ts>*... seqs) {
+        int lengths[] = { seqs->GetLength()... };
+        int minLen = lengths[0];
+        for (int len : lengths) {
+            if (len < minLen) {
+                minLen = len;
+            }
+        }
+        return minLen;
+    }
+
+    void CheckIndex(int index) const {
+        if (index < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (index >= Length()) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+    }
+
+public:
+    static_assert(sizeof...(Ts) > 0, "ZippedSequence needs at least one column");
+
+    ZippedSequence() : columns(new ArraySequence<Ts>()...) {}
+
+    // Копирует по min длине каждую последовательность в свой столбец
+    explicit ZippedSequence(const Sequence<Ts>*... seqs)
+        : columns(MakeColumn<Ts>(seqs, MinLength(seqs...))...) {}
+
+    // Забирает готовые столбцы во владение; длины должны совпадать
+    static ZippedSequence* FromColumns(ArraySequence<Ts>*... owned) {
+        int lengths[] = { owned->GetLength()... };
+        for (int len : lengths) {
+            if (len != lengths[0]) {
+                (delete owned, ...);
+                throw MyException(ErrorType::SequenceError, 0);
+            }
+        }
+        ZippedSequence* result = new ZippedSequence();
+        result->DeleteColumns(Indices{});
+        result->columns = std::tuple<ArraySequence<Ts>*...>(owned...);
+        return result;
+    }
+
+    ZippedSequence(const ZippedSequence& other) : columns(CopyColumns(other.columns, Indices{})) {}
+
+    ZippedSequence& operator=(const ZippedSequence& other) {
+        if (this != &other) {
+            std::tuple<ArraySequence<Ts>*...> copy = CopyColumns(other.columns, Indices{});
+            DeleteColumns(Indices{});
+            columns = copy;
+        }
+        return *this;
+    }
+
+    virtual ~ZippedSequence() {
+        DeleteColumns(Indices{});
+    }
+
+    template <size_t I>
+    const ArraySequence<typename std::tuple_element<I, std::tuple<Ts...>>::type>& Column() const {
+        return *std::get<I>(columns);
+    }
+
+    template <size_t I>
+    SequenceView<typename std::tuple_element<I, std::tuple<Ts...>>::type> ColumnView() const {
+        return SequenceView<typename std::tuple_element<I, std::tuple<Ts...>>::type>(*std::get<I>(columns));
+    }
+
+    // Отдаёт столбцы вызывающему за O(1); сама последовательность становится пустой
+    std::tuple<Sequence<Ts>*...> Unzip() {
+        std::tuple<Sequence<Ts>*...> result = columns;
+        columns = std::tuple<ArraySequence<Ts>*...>(new ArraySequence<Ts>()...);
+        return result;
+    }
+
+    virtual Row GetFirst() const override {
+        if (Length() == 0) {
+            throw MyException(ErrorType::OutOfRange, 2);
+        }
+        return RowAt(0, Indices{});
+    }
+
+    virtual Row GetLast() const override {
+        if (Length() == 0) {
+            throw MyException(ErrorType::OutOfRange, 2);
+        }
+        return RowAt(Length() - 1, Indices{});
+    }
+
+    virtual Row Get(int index) const override {
+        CheckIndex(index);
+        return RowAt(index, Indices{});
+    }
+
+    virtual int GetLength() const override {
+        return Length();
+    }
+
+    virtual Sequence<Row>* GetSubsequence(int startIndex, int endIndex) const override {
+        if (startIndex < 0) {
+            throw MyException(ErrorType::OutOfRange, 0);
+        }
+        if (endIndex < 0 || startIndex > endIndex || endIndex >= Length()) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        return SubsequenceImpl(startIndex, endIndex, Indices{});
+    }
+
+    virtual Sequence<Row>* Append(const Row& item) override {
+        AppendRow(item, Indices{});
+        return this;
+    }
+
+    virtual Sequence<Row>* Prepend(const Row& item) override {
+        PrependRow(item, Indices{});
+        return this;
+    }
+
+    virtual Sequence<Row>* InsertAt(const Row& item, int index) override {
+        CheckIndex(index);
+        InsertRow(item, index, Indices{});
+        return this;
+    }
+
+    virtual Sequence<Row>* RemoveAt(int index) override {
+        if (index < 0 || index >= Length()) {
+            throw MyException(ErrorType::OutOfRange, 1);
+        }
+        RemoveRow(index, Indices{});
+        return this;
+    }
+
+    virtual Sequence<Row>* Concat(const Sequence<Row>* seq) const override {
+        ZippedSequence* result = new ZippedSequence(*this);
+        for (int i = 0; i < seq->GetLength(); i++) {
+            result->Append(seq->Get(i));
+        }
+        return result;
+    }
+
+    virtual const char* TypeName() const override {
+        return "ZippedSequence";
+    }
+
+    virtual Sequence<Row>* Clone() const override {
+        return new ZippedSequence(*this);
+    }
+
+private:
+    template <size_t... Is>
+    Sequence<Row>* SubsequenceImpl(int startIndex, int endIndex, std::index_sequence<Is...>) const {
+        return FromColumns(new ArraySequence<Ts>(std::get<Is>(columns)->GetData() + startIndex,
+                                                 endIndex - startIndex + 1)...);
+    }
+};
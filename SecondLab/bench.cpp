@@ -0,0 +1,283 @@
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <string>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <numeric>
+#include <cstdlib>
+#include <memory>
+#include <iterator>
+
+#include "ArraySequence.h"
+#include "ListSequence.h"
+#include "ImmutableArraySequence.h"
+#include "ImmutableListSequence.h"
+#include "MonadTuple.h"
+#include "Functions.h"
+
+// Замеры основных операций Sequence против std::vector/std::deque.
+// Вывод - CSV в stdout:
+//   container,element,operation,size,ops,total_ns,ns_per_op
+// size - длина последовательности перед замером, ops - сколько операций
+// вошло в total_ns. Каждая ячейка ограничена по времени (CellBudget),
+// поэтому квадратичные случаи (Prepend у массива, Get у списка, любые
+// изменения Immutable) просто делают меньше операций.
+//
+// Запуск: ./bench [максимальный размер]; строки и кортежи не больше 10^6.
+
+typedef std::chrono::steady_clock Clock;
+typedef MonadTuple<int, double> Row;
+
+static const double CellBudget = 0.2;
+static const int SmallTypeLimit = 1000000;
+static volatile long long g_sink = 0;
+
+// Элементы, map/where/reduce для каждого типа
+template <class T> struct Elem;
+
+template <> struct Elem<int> {
+    static const char* Name() { return "int"; }
+    static int Make(int i) { return i * 7 + 3; }
+    static int Map(const int& x) { return x * 2; }
+    static bool Keep(const int& x) { return x % 3 != 0; }
+    static int Combine(const int& x, const int& acc) { return acc ^ x; }
+    static long long Touch(const int& x) { return x; }
+};
+
+template <> struct Elem<std::string> {
+    static const char* Name() { return "string"; }
+    // Длиннее SSO-буфера, чтобы строка жила в куче
+    static std::string Make(int i) { return "sequence-element-" + std::to_string(i); }
+    static std::string Map(const std::string& s) { return s.substr(9); }
+    static bool Keep(const std::string& s) { return s.back() != '0'; }
+    static std::string Combine(const std::string& s, const std::string& acc) { return acc < s ? s : acc; }
+    static long long Touch(const std::string& s) { return static_cast<long long>(s.size()); }
+};
+
+template <> struct Elem<Row> {
+    static const char* Name() { return "MonadTuple<int;double>"; }
+    static Row Make(int i) { return Row(i, i * 0.5); }
+    static Row Map(const Row& r) { return Row(r.get<0>() + 1, r.get<1>() * 2); }
+    static bool Keep(const Row& r) { return r.get<0>() % 3 != 0; }
+    static Row Combine(const Row& r, const Row& acc) { return Row(acc.get<0>() + r.get<0>(), acc.get<1>()); }
+    static long long Touch(const Row& r) { return r.get<0>(); }
+};
+
+// Адаптер для Sequence: изменения Immutable возвращают новую последовательность
+template <class Seq, class T>
+class SeqAdapter {
+private:
+    Sequence<T>* seq;
+
+    void Take(Sequence<T>* result) {
+        if (result != seq) {
+            delete seq;
+            seq = result;
+        }
+    }
+
+public:
+    SeqAdapter() : seq(new Seq()) {}
+    explicit SeqAdapter(std::vector<T>& data) : seq(new Seq(data.data(), static_cast<int>(data.size()))) {}
+    ~SeqAdapter() { delete seq; }
+    SeqAdapter(const SeqAdapter&) = delete;
+    SeqAdapter& operator=(const SeqAdapter&) = delete;
+
+    int Size() const { return seq->GetLength(); }
+    void Append(const T& v) { Take(seq->Append(v)); }
+    void Prepend(const T& v) { Take(seq->Prepend(v)); }
+    void InsertAt(const T& v, int i) { Take(seq->InsertAt(v, i)); }
+    void RemoveAt(int i) { Take(seq->RemoveAt(i)); }
+    long long Get(int i) const { return Elem<T>::Touch(seq->Get(i)); }
+
+    int Concat() const {
+        Sequence<T>* r = seq->Concat(seq);
+        int n = r->GetLength();
+        delete r;
+        return n;
+    }
+
+    int Subsequence(int from, int to) const {
+        Sequence<T>* r = seq->GetSubsequence(from, to);
+        int n = r->GetLength();
+        delete r;
+        return n;
+    }
+
+    int Map() const {
+        Sequence<T>* r = map(static_cast<const Sequence<T>*>(seq), Elem<T>::Map);
+        int n = r->GetLength();
+        delete r;
+        return n;
+    }
+
+    int Where() const {
+        Sequence<T>* r = where(static_cast<const Sequence<T>*>(seq), Elem<T>::Keep);
+        int n = r->GetLength();
+        delete r;
+        return n;
+    }
+
+    long long Reduce() const {
+        return Elem<T>::Touch(reduce(static_cast<const Sequence<T>*>(seq), Elem<T>::Combine, Elem<T>::Make(0)));
+    }
+};
+
+template <class C, class T>
+class StdAdapter {
+private:
+    C c;
+
+public:
+    StdAdapter() {}
+    explicit StdAdapter(std::vector<T>& data) : c(data.begin(), data.end()) {}
+
+    int Size() const { return static_cast<int>(c.size()); }
+    void Append(const T& v) { c.push_back(v); }
+    void Prepend(const T& v) { c.insert(c.begin(), v); }
+    void InsertAt(const T& v, int i) { c.insert(c.begin() + i, v); }
+    void RemoveAt(int i) { c.erase(c.begin() + i); }
+    long long Get(int i) const { return Elem<T>::Touch(c[i]); }
+
+    int Concat() const {
+        C r(c);
+        r.insert(r.end(), c.begin(), c.end());
+        return static_cast<int>(r.size());
+    }
+
+    int Subsequence(int from, int to) const {
+        C r(c.begin() + from, c.begin() + to + 1);
+        return static_cast<int>(r.size());
+    }
+
+    int Map() const {
+        C r(c.size());
+        std::transform(c.begin(), c.end(), r.begin(), Elem<T>::Map);
+        return static_cast<int>(r.size());
+    }
+
+    int Where() const {
+        C r;
+        std::copy_if(c.begin(), c.end(), std::back_inserter(r), Elem<T>::Keep);
+        return static_cast<int>(r.size());
+    }
+
+    long long Reduce() const {
+        T acc = Elem<T>::Make(0);
+        for (const T& x : c) {
+            acc = Elem<T>::Combine(x, acc);
+        }
+        return Elem<T>::Touch(acc);
+    }
+};
+
+class Cell {
+private:
+    const char* container;
+    const char* element;
+    int size;
+
+public:
+    Cell(const char* c, const char* e, int n) : container(c), element(e), size(n) {}
+
+    // body(i) выполняется до limit раз или пока не кончится CellBudget
+    template <class F>
+    void Run(const char* operation, long long limit, F body) const {
+        Clock::time_point start = Clock::now();
+        long long ops = 0;
+        double elapsed = 0.0;
+        while (ops < limit) {
+            body(ops);
+            ops++;
+            if ((ops & 15) == 0 || ops == limit) {
+                elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+                if (elapsed > CellBudget) {
+                    break;
+                }
+            }
+        }
+        elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        double totalNs = elapsed * 1e9;
+        std::cout << container << ',' << element << ',' << operation << ',' << size << ','
+                  << ops << ',' << static_cast<long long>(totalNs) << ',' << totalNs / ops << '\n';
+    }
+};
+
+template <class Adapter, class T>
+void BenchContainer(const char* name, std::vector<T>& data) {
+    const int n = static_cast<int>(data.size());
+    const char* element = Elem<T>::Name();
+    Cell cell(name, element, n);
+    // Мелкие размеры повторяются, чтобы в замер попало хотя бы ~10^4 операций
+    const long long rounds = std::max(1, 10000 / std::max(n, 1));
+    std::mt19937 rng(7);
+
+    {
+        std::unique_ptr<Adapter> growing(new Adapter());
+        cell.Run("Append", n * rounds, [&](long long i) {
+            if (growing->Size() == n) {
+                growing.reset(new Adapter());
+            }
+            growing->Append(data[static_cast<size_t>(i % n)]);
+        });
+    }
+
+    Adapter adapter(data);
+    std::uniform_int_distribution<int> any(0, n - 1);
+    cell.Run("Get", std::max<long long>(n, 10000), [&](long long) { g_sink += adapter.Get(any(rng)); });
+
+    cell.Run("Concat", rounds, [&](long long) { g_sink += adapter.Concat(); });
+    cell.Run("GetSubsequence", rounds, [&](long long) { g_sink += adapter.Subsequence(n / 4, n - 1 - n / 4); });
+    cell.Run("map", rounds, [&](long long) { g_sink += adapter.Map(); });
+    cell.Run("where", rounds, [&](long long) { g_sink += adapter.Where(); });
+    cell.Run("reduce", rounds, [&](long long) { g_sink += adapter.Reduce(); });
+
+    // Вставки и удаления парами, чтобы длина оставалась около n
+    const long long pairOps = std::max<long long>(n, 10000);
+    T extra = Elem<T>::Make(-1);
+    long long inserted = 0;
+    cell.Run("InsertAt", pairOps, [&](long long) {
+        adapter.InsertAt(extra, adapter.Size() / 2);
+        inserted++;
+    });
+    cell.Run("RemoveAt", inserted, [&](long long) { adapter.RemoveAt(adapter.Size() / 2); });
+    inserted = 0;
+    cell.Run("Prepend", pairOps, [&](long long) {
+        adapter.Prepend(extra);
+        inserted++;
+    });
+}
+
+template <class T>
+void BenchElement(int n) {
+    std::vector<T> data;
+    data.reserve(static_cast<size_t>(n));
+    for (int i = 0; i < n; i++) {
+        data.push_back(Elem<T>::Make(i));
+    }
+    BenchContainer<StdAdapter<std::vector<T>, T>>("std::vector", data);
+    BenchContainer<StdAdapter<std::deque<T>, T>>("std::deque", data);
+    BenchContainer<SeqAdapter<ArraySequence<T>, T>>("ArraySequence", data);
+    BenchContainer<SeqAdapter<ListSequence<T>, T>>("ListSequence", data);
+    BenchContainer<SeqAdapter<ImmutableArraySequence<T>, T>>("ImmutableArraySequence", data);
+    BenchContainer<SeqAdapter<ImmutableListSequence<T>, T>>("ImmutableListSequence", data);
+}
+
+int main(int argc, char** argv) {
+    int maxSize = 10000000;
+    if (argc > 1) {
+        maxSize = std::atoi(argv[1]);
+    }
+    std::cout << "container,element,operation,size,ops,total_ns,ns_per_op\n";
+    for (int n = 10; n <= maxSize; n *= 10) {
+        BenchElement<int>(n);
+        if (n <= SmallTypeLimit) {
+            BenchElement<std::string>(n);
+            BenchElement<Row>(n);
+        }
+    }
+    std::cerr << "checksum " << g_sink << "\n";
+    return 0;
+}
@@ -0,0 +1,112 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+#include "ArraySequence.h"
+#include "ListSequence.h"
+#include "Sort.h"
+
+// Сравнение алгоритмов сортировки на разных размерах и распределениях.
+// Время в миллисекундах, лучшее из нескольких запусков.
+
+static std::vector<int> makeData(const std::string& dist, int n, std::mt19937& rng) {
+    std::vector<int> v(n);
+    std::uniform_int_distribution<int> any(-1000000000, 1000000000);
+    for (int i = 0; i < n; i++) {
+        v[i] = any(rng);
+    }
+    if (dist == "sorted") {
+        std::sort(v.begin(), v.end());
+    } else if (dist == "reversed") {
+        std::sort(v.begin(), v.end(), std::greater<int>());
+    } else if (dist == "few_unique") {
+        for (int i = 0; i < n; i++) {
+            v[i] = v[i] % 8;
+        }
+    } else if (dist == "nearly_sorted") {
+        std::sort(v.begin(), v.end());
+        std::uniform_int_distribution<int> pos(0, n - 1);
+        for (int i = 0; i < n / 100 + 1; i++) {
+            std::swap(v[pos(rng)], v[pos(rng)]);
+        }
+    }
+    return v;
+}
+
+template <class F>
+static double timeBest(const std::vector<int>& data, int repeats, F sortOnce) {
+    double best = 1e300;
+    for (int r = 0; r < repeats; r++) {
+        double ms = sortOnce(data);
+        if (ms < best) {
+            best = ms;
+        }
+    }
+    return best;
+}
+
+template <class Seq, class F>
+static double runOn(const std::vector<int>& data, F sorter) {
+    Seq seq;
+    for (int v : data) {
+        seq.Append(v);
+    }
+    auto start = std::chrono::steady_clock::now();
+    sorter(&seq);
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+int main() {
+    const std::vector<int> sizes = {1000, 10000, 100000, 1000000};
+    const std::vector<std::string> dists = {"random", "sorted", "reversed", "few_unique", "nearly_sorted"};
+    std::mt19937 rng(42);
+
+    std::cout << std::left << std::setw(10) << "size" << std::setw(15) << "distribution"
+              << std::right
+              << std::setw(12) << "std::sort"
+              << std::setw(12) << "introsort"
+              << std::setw(12) << "par_merge"
+              << std::setw(12) << "radix"
+              << std::setw(12) << "list_merge" << "\n";
+
+    for (int n : sizes) {
+        int repeats = (n <= 10000) ? 5 : 3;
+        for (const auto& dist : dists) {
+            std::vector<int> data = makeData(dist, n, rng);
+
+            double stdMs = timeBest(data, repeats, [](const std::vector<int>& d) {
+                std::vector<int> copy(d);
+                auto start = std::chrono::steady_clock::now();
+                std::sort(copy.begin(), copy.end());
+                auto stop = std::chrono::steady_clock::now();
+                return std::chrono::duration<double, std::milli>(stop - start).count();
+            });
+            double introMs = timeBest(data, repeats, [](const std::vector<int>& d) {
+                return runOn<ArraySequence<int>>(d, [](ArraySequence<int>* s) { IntroSort(s); });
+            });
+            double parMs = timeBest(data, repeats, [](const std::vector<int>& d) {
+                return runOn<ArraySequence<int>>(d, [](ArraySequence<int>* s) { ParallelMergeSort(s); });
+            });
+            double radixMs = timeBest(data, repeats, [](const std::vector<int>& d) {
+                return runOn<ArraySequence<int>>(d, [](ArraySequence<int>* s) { RadixSort(s); });
+            });
+            double listMs = timeBest(data, repeats, [](const std::vector<int>& d) {
+                return runOn<ListSequence<int>>(d, [](ListSequence<int>* s) { MergeSort(s); });
+            });
+
+            std::cout << std::left << std::setw(10) << n << std::setw(15) << dist
+                      << std::right << std::fixed << std::setprecision(3)
+                      << std::setw(12) << stdMs
+                      << std::setw(12) << introMs
+                      << std::setw(12) << parMs
+                      << std::setw(12) << radixMs
+                      << std::setw(12) << listMs << "\n";
+        }
+    }
+    return 0;
+}
@@ -1,6 +1,15 @@
 #include "UI.h"
+#include <cstring>
+#include <iostream>
 
-int main() {
+int main(int argc, char** argv) {
+    if (argc == 3 && std::strcmp(argv[1], "--script") == 0) {
+        return runScript(argv[2]);
+    }
+    if (argc != 1) {
+        std::cerr << "Usage: " << argv[0] << " [--script file]\n";
+        return 2;
+    }
     runUI();
     return 0;
 }
@@ -2,11 +2,29 @@
 #include <cassert>
 #include <vector>
 #include <string>
+#include <deque>
+#include <cstdio>
+#include <thread>
+#include <atomic>
+#include <algorithm>
 
 #include "DynamicArray.h"
 #include "LinkedList.h"
 #include "ArraySequence.h"
 #include "ListSequence.h"
+#include "Functions.h"
+#include "ParallelFunctions.h"
+#include "Sort.h"
+#include "DequeSequence.h"
+#include "TreapSequence.h"
+#include "ImmutableArraySequence.h"
+#include "ImmutableListSequence.h"
+#include "IndexedListSequence.h"
+#include "MappedArraySequence.h"
+#include "ConcurrentSequence.h"
+#include "SequenceStats.h"
+#include "PackedSequence.h"
+#include "SortedSequence.h"
 
 template<class Seq>
 void checkEqual(const Seq& seq, std::initializer_list<int> ref)
@@ -169,6 +187,1026 @@ void TestCycleSmartReverse()
     }
 }
 
+int square(const int& x) { return x * x; }
+bool isOdd(const int& x) { return x % 2 != 0; }
+int sum(const int& a, const int& b) { return a + b; }
+
+void TestParallelFunctions()
+{
+    const int N = 10000;
+    ArraySequence<int> s;
+    for (int i = 0; i < N; ++i) s.Append(i % 97 - 40);
+
+    for (int grain : {16, 1000, ThreadPool::DefaultGrain, 2 * N}) {
+        Sequence<int>* pm = parallel_map(&s, square, grain);
+        Sequence<int>* m = map(static_cast<const Sequence<int>*>(&s), square);
+        assert(*pm == *m);
+        delete pm; delete m;
+
+        Sequence<int>* pw = parallel_where(&s, isOdd, grain);
+        Sequence<int>* w = where(static_cast<const Sequence<int>*>(&s), isOdd);
+        assert(*pw == *w);
+        delete pw; delete w;
+
+        assert(parallel_reduce(&s, sum, 7, grain) == reduce(static_cast<const Sequence<int>*>(&s), sum, 7));
+
+        auto* pz = parallel_zip(&s, &s, grain);
+        assert(pz->GetLength() == N);
+        assert(pz->Get(N - 1).first == s.Get(N - 1) && pz->Get(N - 1).second == s.Get(N - 1));
+        delete pz;
+    }
+
+    ArraySequence<int> empty;
+    assert(parallel_reduce(&empty, sum, 5, 16) == 5);
+    Sequence<int>* none = parallel_where(&empty, isOdd, 16);
+    assert(none->GetLength() == 0);
+    delete none;
+}
+
+void TestSorting()
+{
+    const int N = 5000;
+    std::vector<int> ref;
+    unsigned seed = 12345;
+    ArraySequence<int> intro, par, radix;
+    ListSequence<int> lst;
+    for (int i = 0; i < N; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        int v = static_cast<int>(seed >> 8) % 2001 - 1000;
+        ref.push_back(v);
+        intro.Append(v); par.Append(v); radix.Append(v); lst.Append(v);
+    }
+    std::sort(ref.begin(), ref.end());
+
+    IntroSort(&intro);
+    ParallelMergeSort(&par, 64);
+    RadixSort(&radix);
+    Sort(static_cast<Sequence<int>*>(&lst));
+    for (int i = 0; i < N; ++i) {
+        assert(intro.Get(i) == ref[i]);
+        assert(par.Get(i) == ref[i]);
+        assert(radix.Get(i) == ref[i]);
+    }
+    assert(lst.GetLength() == N && lst.GetFirst() == ref.front() && lst.GetLast() == ref.back());
+    for (int i = 0; i < 50; ++i) assert(lst.Get(i) == ref[i]);
+    lst.Append(2000);
+    assert(lst.GetLast() == 2000);
+
+    ArraySequence<double> d;
+    for (double v : {3.5, -1.25, 0.0, -7.0, 2.0}) d.Append(v);
+    RadixSort(&d);
+    assert(d.Get(0) == -7.0 && d.Get(1) == -1.25 && d.Get(2) == 0.0 && d.Get(4) == 3.5);
+
+    ListSequence<std::string> words;
+    words.Append("pear")->Append("apple")->Append("fig");
+    MergeSort(&words, std::greater<std::string>());
+    assert(words.GetFirst() == "pear" && words.GetLast() == "apple");
+
+    int arr[]{3, 1, 2};
+    ImmutableArraySequence<int> frozen(arr, 3);
+    bool thrown = false;
+    try { Sort(static_cast<Sequence<int>*>(&frozen)); } catch (const MyException&) { thrown = true; }
+    assert(thrown);
+}
+
+void TestDequeSequence()
+{
+    DequeSequence<int> s;
+    std::deque<int> ref;
+    unsigned seed = 7;
+    for (int step = 0; step < 3000; ++step) {
+        seed = seed * 1103515245u + 12345u;
+        int op = (seed >> 16) % 6;
+        int v = static_cast<int>(seed % 1000);
+        int len = s.GetLength();
+        if (op == 0) { s.Append(v); ref.push_back(v); }
+        else if (op == 1) { s.Prepend(v); ref.push_front(v); }
+        else if (op == 2 && len > 0) { int i = v % len; s.InsertAt(v, i); ref.insert(ref.begin() + i, v); }
+        else if (op == 3 && len > 0) { int i = v % len; s.RemoveAt(i); ref.erase(ref.begin() + i); }
+        else if (op == 4 && len > 0) { assert(s.RemoveFirst() == ref.front()); ref.pop_front(); }
+        else if (op == 5 && len > 0) { assert(s.RemoveLast() == ref.back()); ref.pop_back(); }
+        assert(s.GetLength() == static_cast<int>(ref.size()));
+    }
+    for (int i = 0; i < s.GetLength(); ++i) assert(s.Get(i) == ref[i]);
+
+    DequeSequence<int> d;
+    d.Append(2)->Append(3)->Prepend(1)->Prepend(0);
+    checkEqual(d, {0,1,2,3});
+    Sequence<int>* sub = d.GetSubsequence(1, 2);
+    checkEqual(*sub, {1,2});
+    Sequence<int>* cat = d.Concat(sub);
+    checkEqual(*cat, {0,1,2,3,1,2});
+    delete sub; delete cat;
+}
+
+void TestTreapSequence()
+{
+    TreapSequence<int> s;
+    std::vector<int> ref;
+    unsigned seed = 99;
+    for (int step = 0; step < 20000; ++step) {
+        seed = seed * 1103515245u + 12345u;
+        int op = (seed >> 16) % 4;
+        int v = static_cast<int>(seed % 100000);
+        int len = s.GetLength();
+        if (op == 0) { s.Append(v); ref.push_back(v); }
+        else if (op == 1) { s.Prepend(v); ref.insert(ref.begin(), v); }
+        else if (op == 2 && len > 0) { int i = v % len; s.InsertAt(v, i); ref.insert(ref.begin() + i, v); }
+        else if (op == 3 && len > 0 && step % 3 == 0) { int i = v % len; s.RemoveAt(i); ref.erase(ref.begin() + i); }
+    }
+    assert(s.GetLength() == static_cast<int>(ref.size()));
+    for (int i = 0; i < s.GetLength(); ++i) assert(s.Get(i) == ref[i]);
+
+    int n = s.GetLength();
+    Sequence<int>* sub = s.GetSubsequence(n / 3, n / 2);
+    assert(sub->GetLength() == n / 2 - n / 3 + 1);
+    for (int i = 0; i < sub->GetLength(); ++i) assert(sub->Get(i) == ref[n / 3 + i]);
+    delete sub;
+
+    TreapSequence<int>* tail = s.SplitAt(n / 2 + 17);
+    assert(s.GetLength() == n / 2 + 17 && tail->GetLength() == n - n / 2 - 17);
+    assert(tail->GetFirst() == ref[n / 2 + 17] && s.GetLast() == ref[n / 2 + 16]);
+    s.Absorb(tail);
+    assert(tail->GetLength() == 0);
+    delete tail;
+    for (int i = 0; i < n; ++i) assert(s.Get(i) == ref[i]);
+
+    Sequence<int>* twice = s.Concat(&s);
+    assert(twice->GetLength() == 2 * n && twice->Get(n) == ref[0]);
+    delete twice;
+
+    // Правки диапазонами не дробят куски: все, кроме последнего, не меньше половины
+    TreapSequence<int> r;
+    std::vector<int> rref;
+    int batch[16];
+    for (int step = 0; step < 5000; ++step) {
+        seed = seed * 1103515245u + 12345u;
+        int len = r.GetLength();
+        int k = 1 + static_cast<int>((seed >> 8) % 16);
+        int at = len > 0 ? static_cast<int>((seed >> 4) % (len + 1)) : 0;
+        if (step % 3 != 2 || len < k) {
+            for (int i = 0; i < k; ++i) batch[i] = step * 16 + i;
+            r.InsertRange(batch, k, at);
+            rref.insert(rref.begin() + at, batch, batch + k);
+        } else {
+            if (at + k > len) at = len - k;
+            r.RemoveRange(at, at + k - 1);
+            rref.erase(rref.begin() + at, rref.begin() + at + k);
+        }
+    }
+    assert(r.GetLength() == static_cast<int>(rref.size()));
+    int pos = 0;
+    r.ForEach([&](int v) { assert(v == rref[pos++]); });
+    int full = TreapSequence<int>::HalfCapacity;
+    assert(r.GetChunkCount() <= (r.GetLength() + full - 1) / full + 1);
+
+    // Копии собираются полными кусками
+    int cap = TreapSequence<int>::ChunkCapacity;
+    int k = r.GetLength() - 20;
+    TreapSequence<int>* part = static_cast<TreapSequence<int>*>(r.GetSubsequence(7, 7 + k - 1));
+    assert(part->GetLength() == k && part->GetChunkCount() == (k + cap - 1) / cap);
+    for (int i = 0; i < k; i += 97) assert(part->Get(i) == rref[7 + i]);
+    ListSequence<int> listed;
+    for (int i = 0; i < 1000; ++i) listed.Append(i);
+    TreapSequence<int> head;
+    head.Append(-1);
+    TreapSequence<int>* joined = static_cast<TreapSequence<int>*>(head.Concat(&listed));
+    assert(joined->GetLength() == 1001 && joined->Get(0) == -1 && joined->Get(1000) == 999);
+    assert(joined->GetChunkCount() <= (1001 + cap - 1) / cap + 1);
+    delete part; delete joined;
+}
+
+void TestSequenceView()
+{
+    ArraySequence<int> s;
+    for (int i = 0; i < 10; ++i) s.Append(i);
+
+    SequenceView<int> all(s);
+    SequenceView<int> mid(s, 2, 6);
+    checkEqual(mid, {2,3,4,5,6});
+    assert(mid.GetData() == s.GetData() + 2);
+
+    SequenceView<int> inner = mid.GetSubsequence(1, 3);
+    checkEqual(inner, {3,4,5});
+    assert(inner.GetData() == s.GetData() + 3);
+
+    Sequence<int>* sq = map(mid, square);
+    checkEqual(*sq, {4,9,16,25,36});
+    Sequence<int>* odd = where(mid, isOdd);
+    checkEqual(*odd, {3,5});
+    assert(reduce(all, sum, 0) == 45);
+    delete sq; delete odd;
+
+    DynamicArray<int> arr(5);
+    arr.Set(4, 8);
+    SequenceView<int> tail(arr, 3, 4);
+    checkEqual(tail, {0,8});
+    ArraySequence<int>* copy = tail.ToSequence();
+    copy->Append(1);
+    checkEqual(*copy, {0,8,1});
+    delete copy;
+
+    bool thrown = false;
+    try { mid.GetSubsequence(0, 5); } catch (const MyException&) { thrown = true; }
+    assert(thrown);
+
+    Sequence<int>* sub = s.GetSubsequence(0, 0);
+    sub->Append(1)->Append(2);
+    checkEqual(*sub, {0,1,2});
+    delete sub;
+}
+
+void TestMonadTuple()
+{
+    static_assert(sizeof(MonadTuple<int, double>) == sizeof(std::tuple<int, double>),
+                  "MonadTuple must store values inline");
+
+    MonadTuple<int, std::string> t(7, "seven");
+    assert(t.get<0>() == 7 && t.get<1>() == "seven");
+    assert(t.toString() == "(7, seven)");
+
+    MonadTuple<int, std::string> copy = t;
+    copy.get<0>() = 8;
+    assert(t.get<0>() == 7 && copy.get<0>() == 8 && copy != t);
+
+    std::unique_ptr<TupleBase> erased = t.Erase();
+    assert(erased->size() == 2 && erased->toString() == "(7, seven)");
+    assert(erased->clone()->toString() == "(7, seven)");
+
+    ArraySequence<int> a; a.Append(1)->Append(2)->Append(3);
+    ListSequence<int> b; b.Append(10)->Append(20);
+    auto* zipped = zip_as_tuple<int, int>(&a, &b);
+    assert(zipped->GetLength() == 2);
+    assert(zipped->Get(1) == (MonadTuple<int, int>(2, 20)));
+    delete zipped;
+}
+
+void TestZippedSequence()
+{
+    ArraySequence<int> ids; ids.Append(1)->Append(2)->Append(3)->Append(4);
+    ListSequence<std::string> names; names.Append("a")->Append("b")->Append("c");
+
+    ZippedSequence<int, std::string>* z = zip_columns<int, std::string>(&ids, &names);
+    assert(z->GetLength() == 3);
+    assert(z->Get(1) == (MonadTuple<int, std::string>(2, "b")));
+    assert(z->Column<0>().GetLength() == 3 && z->ColumnView<1>()[2] == "c");
+    assert(reduce(z->ColumnView<0>(), sum, 0) == 6);
+
+    z->Append(MonadTuple<int, std::string>(9, "z"));
+    z->RemoveAt(0);
+    Sequence<MonadTuple<int, std::string>>* sub = z->GetSubsequence(1, 2);
+    assert(sub->GetFirst() == (MonadTuple<int, std::string>(3, "c")));
+    delete sub;
+
+    auto copied = unzip_tuple(static_cast<const Sequence<MonadTuple<int, std::string>>*>(z));
+    checkEqual(*std::get<0>(copied), {2,3,9});
+    assert(std::get<1>(copied)->GetLast() == "z");
+    delete std::get<0>(copied); delete std::get<1>(copied);
+
+    const int* column = z->Column<0>().GetData();
+    auto taken = z->Unzip();
+    assert(static_cast<ArraySequence<int>*>(std::get<0>(taken))->GetData() == column);
+    assert(z->GetLength() == 0);
+    delete std::get<0>(taken); delete std::get<1>(taken);
+    delete z;
+
+    auto* rows = zip_as_tuple<int, int>(&ids, &ids);
+    auto split = unzip_tuple(rows);
+    checkEqual(*std::get<1>(split), {1,2,3,4});
+    delete std::get<0>(split); delete std::get<1>(split); delete rows;
+}
+
+void TestArraySequenceStorage()
+{
+    ArraySequence<int> small;
+    small.Append(1)->Append(2);
+    ArraySequence<int> smallCopy(small);
+    assert(!small.IsShared() && smallCopy.GetData() != small.GetData());
+
+    ArraySequence<int> big;
+    for (int i = 0; i < 100; ++i) big.Append(i);
+    ArraySequence<int> shared(big);
+    Sequence<int>* clone = big.Clone();
+    assert(big.IsShared() && shared.IsShared());
+    assert(static_cast<const ArraySequence<int>&>(shared).GetData() ==
+           static_cast<const ArraySequence<int>&>(big).GetData());
+
+    shared.Append(100);
+    shared.RemoveAt(0);
+    assert(shared.GetLength() == 100 && shared.GetFirst() == 1);
+    assert(big.GetLength() == 100 && big.GetFirst() == 0 && big.GetLast() == 99);
+    assert(*clone == big);
+    delete clone;
+    assert(!big.IsShared());
+
+    ArraySequence<int> assigned;
+    assigned = big;
+    assigned.reverse();
+    assert(assigned.GetFirst() == 99 && big.GetFirst() == 0);
+
+    big.SetCopyOnWrite(false);
+    ArraySequence<int> deep(big);
+    assert(!deep.IsShared() && deep == big);
+
+    ArraySequence<std::string> words;
+    for (int i = 0; i < 6; ++i) words.Prepend(std::to_string(i));
+    words.InsertAt("x", 3);
+    assert(words.GetFirst() == "5" && words.Get(3) == "x" && words.GetLast() == "0");
+
+    // Встроенный буфер только у тривиальных типов
+    assert(ArraySequence<std::string>::InlineCapacity == 0);
+    assert(sizeof(ArraySequence<std::string>) < sizeof(ArraySequence<int>) + 4 * sizeof(std::string));
+    ArraySequence<std::string> empty;
+    ArraySequence<std::string> emptyCopy(empty);
+    assert(emptyCopy.GetLength() == 0 && !empty.IsShared());
+    emptyCopy.Append("a");
+    ArraySequence<std::string> one(emptyCopy);
+    assert(one.IsShared() && one.GetFirst() == "a" && empty.GetLength() == 0);
+}
+
+void TestCheckPolicies()
+{
+    DynamicArray<int> checked(3);
+    bool thrown = false;
+    try { checked.Get(3); } catch (const MyException& ex) { thrown = ex.getSubCode() == 1; }
+    assert(thrown);
+    thrown = false;
+    try { checked[-1] = 0; } catch (const MyException& ex) { thrown = ex.getSubCode() == 0; }
+    assert(thrown);
+
+    DynamicArray<int, UncheckedPolicy> fast(3);
+    fast.SetUnchecked(2, 5);
+    assert(fast.Get(2) == 5 && fast.GetUnchecked(2) == 5);
+
+    ArraySequence<int, UncheckedPolicy> raw;
+    raw.Append(1)->Append(2);
+    ArraySequence<int, UncheckedPolicy> rawCopy(raw);
+    assert(rawCopy.Get(1) == 2 && rawCopy.GetUnchecked(0) == 1);
+
+    ArraySequence<int> s;
+    s.Append(4);
+    thrown = false;
+    try { s.Get(1); } catch (const MyException&) { thrown = true; }
+    assert(thrown);
+
+    LinkedList<int, DebugCheckedPolicy> lst;
+    lst.Append(1); lst.Append(2);
+    assert(lst.Get(1) == 2 && lst.GetUnchecked(0) == 1);
+}
+
+template<class Seq>
+void RangeScenarios()
+{
+    int base[]{1,2,3,4,5};
+    int extra[]{7,8,9};
+    Seq seq(base, 5);
+    seq.InsertRange(extra, 3, 1);
+    checkEqual(seq, {1,7,8,9,2,3,4,5});
+    seq.InsertRange(extra, 2, 7);
+    checkEqual(seq, {1,7,8,9,2,3,4,7,8,5});
+    seq.AppendRange(extra, 3);
+    seq.InsertRange(extra, 0, 0);
+    checkEqual(seq, {1,7,8,9,2,3,4,7,8,5,7,8,9});
+    seq.RemoveRange(1, 3);
+    checkEqual(seq, {1,2,3,4,7,8,5,7,8,9});
+    seq.RemoveRange(6, 9);
+    seq.RemoveRange(0, 0);
+    checkEqual(seq, {2,3,4,7,8});
+
+    std::vector<int> big(300);
+    for (int i = 0; i < 300; ++i) big[i] = i;
+    seq.InsertRange(big.data(), 300, 3);
+    assert(seq.GetLength() == 305 && seq.Get(3) == 0 && seq.Get(302) == 299 && seq.Get(303) == 7);
+    seq.RemoveRange(3, 302);
+    checkEqual(seq, {2,3,4,7,8});
+
+    bool thrown = false;
+    try { seq.RemoveRange(4, 6); } catch (const MyException&) { thrown = true; }
+    assert(thrown);
+    thrown = false;
+    try { seq.InsertRange(extra, 1, 7); } catch (const MyException&) { thrown = true; }
+    assert(thrown);
+}
+
+// Копирование отрицательного значения бросает, пока armed; live - число живых экземпляров
+struct CopyFails {
+    static int live;
+    static bool armed;
+    int v = 0;
+    CopyFails(int x = 0) : v(x) { ++live; }
+    CopyFails(const CopyFails& other) : v(other.v) {
+        if (armed && other.v < 0) throw std::runtime_error("copy failed");
+        ++live;
+    }
+    CopyFails& operator=(const CopyFails&) = default;
+    ~CopyFails() { --live; }
+};
+int CopyFails::live = 0;
+bool CopyFails::armed = true;
+
+void TestRangeOperations()
+{
+    RangeScenarios<ArraySequence<int>>();
+    RangeScenarios<ListSequence<int>>();
+    RangeScenarios<DequeSequence<int>>();
+    RangeScenarios<TreapSequence<int>>();
+
+    // Вставка куска собственного буфера
+    ArraySequence<int> self;
+    for (int i = 0; i < 10; ++i) self.Append(i);
+    self.InsertRange(self.GetData() + 5, 5, 0);
+    assert(self.GetLength() == 15 && self.Get(0) == 5 && self.Get(4) == 9 && self.Get(5) == 0);
+
+    int arr[]{1,2,3};
+    ImmutableArraySequence<int> ia(arr, 3);
+    Sequence<int>* ia2 = ia.AppendRange(arr, 2);
+    checkEqual(ia, {1,2,3});
+    checkEqual(*ia2, {1,2,3,1,2});
+    Sequence<int>* ia3 = ia.RemoveRange(0, 1);
+    checkEqual(*ia3, {3});
+    Sequence<int>* ia4 = ia.RemoveAt(0);
+    checkEqual(ia, {1,2,3});
+    checkEqual(*ia4, {2,3});
+    Sequence<int>* iaCat = ia.Concat(ia2);
+    checkEqual(*iaCat, {1,2,3,1,2,3,1,2});
+
+    // Копия неизменяемой делит буфер с оригиналом: источник внутри этого буфера
+    int ten[]{0,1,2,3,4,5,6,7,8,9};
+    ImmutableArraySequence<int> big(ten, 10);
+    const ImmutableArraySequence<int>& cbig = big;
+    Sequence<int>* bigCat = big.Concat(&big);
+    assert(bigCat->GetLength() == 20 && bigCat->Get(10) == 0 && bigCat->Get(19) == 9);
+    Sequence<int>* bigApp = big.AppendRange(cbig.GetData(), 10);
+    assert(bigApp->GetLength() == 20 && bigApp->Get(10) == 0 && bigApp->Get(19) == 9);
+    Sequence<int>* bigIns = big.InsertRange(cbig.GetData() + 2, 3, 0);
+    checkEqual(*bigIns, {2,3,4,0,1,2,3,4,5,6,7,8,9});
+    assert(big.GetLength() == 10);
+    delete bigCat; delete bigApp; delete bigIns;
+
+    ImmutableListSequence<int> il(arr, 3);
+    Sequence<int>* il2 = il.InsertRange(arr, 3, 1);
+    checkEqual(il, {1,2,3});
+    checkEqual(*il2, {1,1,2,3,2,3});
+    Sequence<int>* ilCat = il.Concat(&ia);
+    checkEqual(*ilCat, {1,2,3,1,2,3});
+
+    delete ia2; delete ia3; delete ia4; delete iaCat; delete il2; delete ilCat;
+
+    // Сбой копирования посреди диапазона: недостроенная цепочка освобождается
+    {
+        LinkedList<CopyFails> lst;
+        lst.Append(CopyFails(1));
+        CopyFails batch[]{CopyFails(2), CopyFails(3), CopyFails(-1), CopyFails(4)};
+        bool thrown = false;
+        try { lst.InsertRange(batch, 4, 1); } catch (const std::runtime_error&) { thrown = true; }
+        assert(thrown && lst.GetLength() == 1 && CopyFails::live == 5);
+    }
+    assert(CopyFails::live == 0);
+}
+
+void TestListSplice()
+{
+    ListSequence<int> a{1,2,3};
+    ListSequence<int> b{4,5};
+    Sequence<int>* copy = a.Concat(&b);
+    checkEqual(*copy, {1,2,3,4,5});
+    checkEqual(b, {4,5});
+    delete copy;
+
+    a.Absorb(&b);
+    checkEqual(a, {1,2,3,4,5});
+    assert(b.GetLength() == 0);
+
+    ListSequence<int>* tail = a.SplitAt(3);
+    checkEqual(a, {1,2,3});
+    checkEqual(*tail, {4,5});
+    a.Splice(tail, 1);
+    checkEqual(a, {1,4,5,2,3});
+    assert(tail->GetLength() == 0);
+    delete tail;
+
+    ListSequence<int>* all = a.SplitAt(0);
+    assert(a.GetLength() == 0);
+    a.Splice(all, 0);
+    a.Append(6);
+    checkEqual(a, {1,4,5,2,3,6});
+    ListSequence<int>* none = a.SplitAt(6);
+    assert(none->GetLength() == 0);
+    none->Append(7);
+    a.Absorb(none)->Append(8);
+    checkEqual(a, {1,4,5,2,3,6,7,8});
+    delete all; delete none;
+
+    bool thrown = false;
+    try { a.Absorb(&a); } catch (const MyException&) { thrown = true; }
+    assert(thrown);
+
+    // Неизменяемый список не отдаёт узлы ни как this, ни как аргумент
+    int arr[]{1,2,3};
+    ImmutableListSequence<int> frozen(arr, 3);
+    ListSequence<int> extra{9};
+    ListSequence<int>* base = &frozen;
+    ListSequence<int>* joined = base->Absorb(&extra);
+    ListSequence<int>* spliced = base->Splice(&extra, 1);
+    ListSequence<int>* cut = base->SplitAt(1);
+    checkEqual(frozen, {1,2,3});
+    checkEqual(extra, {9});
+    checkEqual(*joined, {1,2,3,9});
+    checkEqual(*spliced, {1,9,2,3});
+    checkEqual(*cut, {2,3});
+    assert(cut->IsImmutable());
+    delete joined; delete spliced; delete cut;
+
+    thrown = false;
+    try { extra.Absorb(&frozen); } catch (const MyException& ex) { thrown = ex.getSubCode() == 1; }
+    assert(thrown);
+    thrown = false;
+    try { extra.Splice(&frozen, 0); } catch (const MyException&) { thrown = true; }
+    assert(thrown);
+    checkEqual(frozen, {1,2,3});
+    checkEqual(extra, {9});
+
+    // Сбой копирования аргумента не оставляет недоделанный результат
+    {
+        CopyFails one[]{CopyFails(1)};
+        ImmutableListSequence<CopyFails> keep(one, 1);
+        ListSequence<CopyFails> bad;
+        CopyFails::armed = false;
+        bad.Append(CopyFails(-1));
+        CopyFails::armed = true;
+        ListSequence<CopyFails>* frozenBase = &keep;
+        thrown = false;
+        try { frozenBase->Absorb(&bad); } catch (const std::runtime_error&) { thrown = true; }
+        assert(thrown);
+        thrown = false;
+        try { frozenBase->Splice(&bad, 0); } catch (const std::runtime_error&) { thrown = true; }
+        assert(thrown && CopyFails::live == 3);
+    }
+    assert(CopyFails::live == 0);
+}
+
+void TestIndexedListSequence()
+{
+    int arr[]{5,3,5,7};
+    IndexedListSequence<int> seq(arr, 4);
+    assert(seq.Contains(5) && seq.Count(5) == 2 && !seq.Contains(4));
+    assert(seq.Next(5) == 3 && seq.Next(3) == 5);
+
+    seq.Prepend(7);
+    assert(seq.Next(7) == 5 && seq.Count(7) == 2);
+    seq.RemoveAt(0);
+    bool thrown = false;
+    try { seq.Next(7); } catch (const MyException& ex) { thrown = ex.getSubCode() == 3; }
+    assert(thrown);
+
+    seq.RemoveAt(0);
+    assert(seq.Count(5) == 1 && seq.Next(5) == 7);
+    seq.InsertAt(5, 0);
+    assert(seq.Next(5) == 3);
+    seq.InsertAt(3, 2);
+    checkEqual(seq, {5,3,3,5,7});
+    assert(seq.Next(3) == 3 && seq.Count(3) == 2);
+
+    thrown = false;
+    try { seq.Next(42); } catch (const MyException& ex) { thrown = ex.getSubCode() == 6; }
+    assert(thrown);
+
+    IndexedListSequence<int> big(0.75);
+    for (int i = 0; i < 1000; ++i) big.Append(i);
+    assert(big.GetIndexCapacity() * 0.75 >= 1000);
+    assert(big.GetIndexMemory() == big.GetIndexCapacity() * (sizeof(void*) * 2));
+    for (int i = 0; i < 1000; i += 2) big.RemoveAt(i / 2);
+    assert(big.GetLength() == 500 && !big.Contains(0) && big.Contains(1) && big.Next(1) == 3);
+    big.SetMaxLoadFactor(0.25);
+    assert(big.GetIndexCapacity() * 0.25 >= 500 && big.Next(997) == 999);
+
+    big.reverse();
+    assert(big.Next(999) == 997);
+    big.RemoveRange(0, 249);
+    assert(!big.Contains(999) && big.Contains(1) && *big.Find(1) == 1 && big.Find(999) == nullptr);
+
+    IndexedListSequence<std::string> words;
+    words.Append("a"); words.Append("b");
+    IndexedListSequence<std::string> copy(words);
+    copy.Append("c");
+    assert(copy.Next("b") == "c" && words.Contains("b") && !words.Contains("c"));
+}
+
+template<class T>
+void SimdScenarios()
+{
+    for (int n : {0, 1, 3, 7, 8, 31, 33, 100, 1001}) {
+        ArraySequence<T> arr;
+        ListSequence<T> lst;
+        for (int i = 0; i < n; ++i) {
+            T v = static_cast<T>((i * 37) % 101 - 50);
+            arr.Append(v);
+            lst.Append(v);
+        }
+        const Sequence<T>* a = &arr;
+        const Sequence<T>* l = &lst;
+        assert(reduce(a, SumOp<T>, T(5)) == reduce(l, SumOp<T>, T(5)));
+        assert(reduce(a, MinOp<T>, T(0)) == reduce(l, MinOp<T>, T(0)));
+        assert(reduce(a, MaxOp<T>, T(-100)) == reduce(l, MaxOp<T>, T(-100)));
+        assert(reduce(SequenceView<T>(arr), MaxOp<T>, T(-100)) == reduce(l, MaxOp<T>, T(-100)));
+        for (T probe : {T(-50), T(0), T(13), T(1000)}) {
+            assert(count_of(a, probe) == count_of(l, probe));
+            assert(index_of(a, probe) == index_of(l, probe));
+        }
+    }
+}
+
+void TestSimdKernels()
+{
+    SimdScenarios<int>();
+    SimdScenarios<float>();
+    SimdScenarios<double>();
+
+    int data[40];
+    for (int i = 0; i < 40; ++i) data[i] = i;
+    data[37] = -7;
+    assert(simd::Min(data, 40) == -7 && simd::Max(data, 40) == 39);
+    assert(simd::Find(data, 40, -7) == 37 && simd::Find(data, 37, -7) == -1);
+    assert(simd::Count(data, 40, 5) == 1 && simd::Sum(data, 3) == 3);
+}
+
+void TestMappedArraySequence()
+{
+    const char* path = "mapped_test.bin";
+    std::vector<double> values(1000);
+    for (int i = 0; i < 1000; ++i) values[i] = i * 0.5;
+    MappedArraySequence<double>::WriteFile(path, values.data(), 1000);
+
+    {
+        MappedArraySequence<double> ro(path);
+        assert(ro.GetLength() == 1000 && ro.Get(10) == 5.0 && ro.GetLast() == 499.5);
+        assert(reduce(ro.AsView(), SumOp<double>, 0.0) == 249750.0);
+        bool thrown = false;
+        try { ro.Append(1.0); } catch (const MyException& ex) { thrown = ex.getType() == ErrorType::SequenceError; }
+        assert(thrown);
+        Sequence<double>* again = ro.Clone();
+        assert(*again == ro);
+        delete again;
+
+        ArraySequence<double> tail; tail.Append(-1.0)->Append(-2.0);
+        ListSequence<double> listTail; listTail.Append(-3.0);
+        Sequence<double>* joined = ro.Concat(&tail);
+        Sequence<double>* withList = ro.Concat(&listTail);
+        Sequence<double>* doubled = ro.Concat(&ro);
+        assert(joined->GetLength() == 1002 && joined->Get(999) == 499.5 && joined->GetLast() == -2.0);
+        assert(withList->GetLength() == 1001 && withList->GetLast() == -3.0);
+        assert(doubled->GetLength() == 2000 && doubled->Get(1000) == 0.0 && doubled->GetLast() == 499.5);
+        delete joined; delete withList; delete doubled;
+    }
+    {
+        MappedArraySequence<double> cow(path, MapMode::CopyOnWrite);
+        cow.Set(0, -1.0);
+        cow.RemoveRange(1, 998);
+        assert(cow.IsMapped() && cow.GetLength() == 2 && cow.GetFirst() == -1.0 && cow.GetLast() == 499.5);
+        cow.Append(7.0);
+        assert(!cow.IsMapped() && cow.GetLength() == 3 && cow.Get(2) == 7.0);
+    }
+    MappedArraySequence<double> reopened(path);
+    assert(reopened.GetFirst() == 0.0 && reopened.GetLength() == 1000);
+
+    MappedArraySequence<char> bytes(path);
+    assert(bytes.GetLength() == 8000);
+    struct Triple { char c[3]; };
+    bool thrown = false;
+    try { MappedArraySequence<Triple> odd(path); } catch (const MyException& ex) { thrown = ex.getSubCode() == 1; }
+    assert(thrown);
+    std::remove(path);
+
+    thrown = false;
+    try { MappedArraySequence<int> missing("no_such_file.bin"); } catch (const MyException& ex) { thrown = ex.getType() == ErrorType::FileError; }
+    assert(thrown);
+}
+
+void TestConcurrentSequence()
+{
+    ConcurrentSequence<int> small(64);
+    int arr[]{1,2,3};
+    small.AppendRange(arr, 3)->Append(4);
+    assert(small.Get(2) == 3 && small.GetLast() == 4 && small.IsPublished(3));
+    ArraySequence<int>* frozen = small.Freeze();
+    checkEqual(*frozen, {1,2,3,4});
+    assert(small.GetLength() == 0);
+    delete frozen;
+
+    const int threads = 4;
+    const int perThread = 5000;
+    ConcurrentSequence<int> shared(16);
+    std::vector<std::thread> writers;
+    for (int t = 0; t < threads; ++t) {
+        writers.emplace_back([&shared, t] {
+            for (int i = 0; i < perThread; ++i) shared.Append(t * perThread + i);
+        });
+    }
+    long long seen = 0;
+    while (seen < 100) {
+        int length = shared.GetLength();
+        int value;
+        if (length > 0 && shared.TryGet(length - 1, value)) {
+            assert(value >= 0 && value < threads * perThread);
+        }
+        ++seen;
+    }
+    for (auto& w : writers) w.join();
+    assert(shared.GetLength() == threads * perThread);
+
+    // map во время добавлений видит снимок длины и не пишет за конец результата
+    ConcurrentSequence<int> growing(8);
+    for (int i = 0; i < 100; ++i) growing.Append(i);
+    std::atomic<bool> grown(false);
+    std::thread grower([&growing, &grown] {
+        for (int i = 100; i < 1000000; ++i) growing.Append(i);
+        grown = true;
+    });
+    while (!grown) {
+        ArraySequence<int>* mapped = static_map(growing, [](int x) { return x + 1; });
+        assert(mapped->GetLength() >= 100);
+        for (int i = 0; i < mapped->GetLength(); ++i) assert(mapped->Get(i) == i + 1);
+        delete mapped;
+    }
+    grower.join();
+
+    frozen = shared.Freeze();
+    std::vector<int> got(frozen->GetData(), frozen->GetData() + frozen->GetLength());
+    std::sort(got.begin(), got.end());
+    for (int i = 0; i < threads * perThread; ++i) assert(got[i] == i);
+    delete frozen;
+
+    bool thrown = false;
+    try { shared.Prepend(1); } catch (const MyException& ex) { thrown = ex.getSubCode() == 1; }
+    assert(thrown);
+
+    // Писатель упал после резервации: читатели получают ошибку, а не ждут вечно
+    struct Fragile {
+        int v = 0;
+        Fragile() = default;
+        Fragile(int x) : v(x) {}
+        Fragile(const Fragile& other) = default;
+        Fragile& operator=(const Fragile& other) {
+            if (other.v < 0) throw std::runtime_error("copy failed");
+            v = other.v;
+            return *this;
+        }
+    };
+    ConcurrentSequence<Fragile> fragile(4);
+    Fragile batch[]{Fragile(1), Fragile(-1), Fragile(3)};
+    thrown = false;
+    try { fragile.AppendRange(batch, 3); } catch (const std::runtime_error&) { thrown = true; }
+    assert(thrown && fragile.GetLength() == 3);
+    assert(fragile.Get(0).v == 1 && fragile.IsPublished(0) && !fragile.IsPublished(2));
+    for (int i = 1; i < 3; ++i) {
+        thrown = false;
+        try { fragile.Get(i); } catch (const MyException& ex) { thrown = ex.getSubCode() == 1; }
+        assert(thrown);
+    }
+    Fragile out;
+    thrown = false;
+    try { fragile.TryGet(2, out); } catch (const MyException&) { thrown = true; }
+    assert(thrown);
+    thrown = false;
+    try { fragile.Freeze(); } catch (const MyException&) { thrown = true; }
+    assert(thrown);
+}
+
+template<class Seq>
+void StaticScenarios()
+{
+    int arr[]{1,2,3,4,5,6};
+    Seq seq(arr, 6);
+    ArraySequence<int>* doubled = static_map(seq, [](int x) { return x * 2; });
+    checkEqual(*doubled, {2,4,6,8,10,12});
+    ArraySequence<int>* even = static_where(seq, [](int x) { return x % 2 == 0; });
+    checkEqual(*even, {2,4,6});
+    assert(static_reduce(seq, [](int x, long long acc) { return acc * 10 + x; }, 0LL) == 123456);
+    const Sequence<int>& base = seq;
+    ArraySequence<std::string>* text = static_map(base, [](int x) { return std::to_string(x); });
+    assert(text->GetLength() == 6 && text->GetLast() == "6");
+    delete doubled; delete even; delete text;
+}
+
+void TestStaticDispatch()
+{
+    StaticScenarios<ArraySequence<int>>();
+    StaticScenarios<ListSequence<int>>();
+    StaticScenarios<DequeSequence<int>>();
+    StaticScenarios<TreapSequence<int>>();
+    StaticScenarios<ImmutableArraySequence<int>>();
+    StaticScenarios<IndexedListSequence<int>>();
+
+    DequeSequence<int> ring;
+    for (int i = 0; i < 6; ++i) ring.Append(i);
+    ring.RemoveFirst(); ring.RemoveFirst();
+    for (int i = 6; i < 10; ++i) ring.Append(i);
+    assert(static_reduce(ring, [](int x, int acc) { return acc * 10 + x; }, 0) == 23456789);
+
+    ArraySequence<int> arr;
+    for (int i = 0; i < 10; ++i) arr.Append(i);
+    assert(static_reduce(SequenceView<int>(arr, 2, 4), [](int x, int acc) { return acc + x; }, 0) == 9);
+    ListSequence<int> lst{3,1,2};
+    Sequence<int>* mapped = map(static_cast<const Sequence<int>*>(&lst), square);
+    checkEqual(*mapped, {9,1,4});
+    delete mapped;
+
+    // Адаптер для Sequence<T>& обходит контейнер через VisitItems, без Get
+    struct CountingIndexedList : IndexedListSequence<int> {
+        mutable int gets = 0;
+        int Get(int index) const override { ++gets; return IndexedListSequence<int>::Get(index); }
+    };
+    CountingIndexedList indexed;
+    for (int i = 1; i <= 4; ++i) indexed.Append(i);
+    const Sequence<int>& indexedBase = indexed;
+    ArraySequence<int>* squares = static_map(indexedBase, [](int x) { return x * x; });
+    checkEqual(*squares, {1,4,9,16});
+    assert(indexed.gets == 0);
+    delete squares;
+
+    unsigned nibbleValues[]{7,1,15};
+    PackedSequence<unsigned, 4> packed(nibbleValues, 3);
+    SortedSequence<int> sorted(arr.GetData(), 10);
+    const Sequence<unsigned>& packedBase = packed;
+    const Sequence<int>& sortedBase = sorted;
+    assert(static_reduce(packedBase, [](unsigned x, unsigned acc) { return acc + x; }, 0u) == 23);
+    ArraySequence<int>* odd = static_where(sortedBase, [](int x) { return x % 2 == 1; });
+    checkEqual(*odd, {1,3,5,7,9});
+    delete odd;
+}
+
+void TestSequenceStats()
+{
+    SequenceStats::Reset();
+    SequenceStatsSnapshot before = SequenceStats::Snapshot();
+    {
+        ArraySequence<int> arr;
+        for (int i = 0; i < 5; ++i) arr.Append(i);
+        ListSequence<int> lst{1,2,3};
+        assert(lst.Get(2) == 3);
+    }
+    SequenceStatsSnapshot diff = SequenceStats::Snapshot() - before;
+    if (!SequenceStats::Enabled) {
+        for (int i = 0; i < static_cast<int>(SeqStat::Count); ++i) assert(diff.values[i] == 0);
+        return;
+    }
+    // 5-й Append выводит массив из встроенного буфера в кучу на 8 элементов
+    assert(diff[SeqStat::Reallocations] == 1);
+    assert(diff[SeqStat::ElementMoves] == 4);
+    assert(diff[SeqStat::Allocations] == 1 + 3);
+    assert(diff[SeqStat::BytesAllocated] >= static_cast<long long>(8 * sizeof(int)));
+    assert(diff[SeqStat::Deallocations] == diff[SeqStat::Allocations]);
+    assert(diff[SeqStat::NodeHops] >= 2);
+}
+
+enum class Color : unsigned char { Red, Green, Blue };
+
+// Случайные операции над упакованной последовательностью сверяются с std::vector
+template<class T, int Bits>
+void PackedScenarios(int lo, int hi)
+{
+    PackedSequence<T, Bits> packed;
+    std::vector<T> ref;
+    unsigned seed = 12345;
+    auto next = [&]() { seed = seed * 1103515245u + 12345u; return static_cast<int>((seed >> 8) % 1000000); };
+    for (int step = 0; step < 3000; ++step) {
+        T value = static_cast<T>(lo + next() % (hi - lo + 1));
+        int op = next() % 5;
+        if (op <= 1 || ref.empty()) {
+            packed.Append(value); ref.push_back(value);
+        } else if (op == 2) {
+            int i = next() % static_cast<int>(ref.size());
+            packed.InsertAt(value, i); ref.insert(ref.begin() + i, value);
+        } else if (op == 3) {
+            int i = next() % static_cast<int>(ref.size());
+            packed.RemoveAt(i); ref.erase(ref.begin() + i);
+        } else {
+            int i = next() % static_cast<int>(ref.size());
+            packed[i] = value; ref[i] = value;
+        }
+    }
+    assert(packed.GetLength() == static_cast<int>(ref.size()));
+    for (int i = 0; i < packed.GetLength(); ++i) assert(packed.Get(i) == ref[i]);
+
+    T probe = static_cast<T>(lo);
+    assert(packed.Count(probe) == static_cast<int>(std::count(ref.begin(), ref.end(), probe)));
+    ArraySequence<int>* positions = packed.IndicesOf(probe);
+    for (int k = 0; k < positions->GetLength(); ++k) assert(ref[positions->Get(k)] == probe);
+    assert(positions->GetLength() == packed.Count(probe));
+    delete positions;
+
+    Sequence<T>* sub = packed.GetSubsequence(3, static_cast<int>(ref.size()) - 5);
+    for (int i = 0; i < sub->GetLength(); ++i) assert(sub->Get(i) == ref[i + 3]);
+    delete sub;
+    packed.RemoveRange(10, 70);
+    ref.erase(ref.begin() + 10, ref.begin() + 71);
+    for (int i = 0; i < packed.GetLength(); ++i) assert(packed.Get(i) == ref[i]);
+}
+
+void TestPackedSequence()
+{
+    PackedScenarios<bool, 1>(0, 1);
+    PackedScenarios<unsigned char, 3>(0, 7);
+    PackedScenarios<int, 5>(-16, 15);
+    PackedScenarios<Color, 2>(0, 2);
+
+    bool flags[130];
+    for (int i = 0; i < 130; ++i) flags[i] = (i % 3 == 0);
+    BitSequence bits(flags, 130);
+    assert(bits.Sum() == 44 && bits.Count(false) == 86);
+    assert(bits.GetMemory() == 3 * sizeof(std::uint64_t));
+    bits[1] = true;
+    assert(bits.Sum() == 45 && bits[1] == true);
+    BitSequence* ones = bits.Where([](bool b) { return b; });
+    assert(ones->GetLength() == 45);
+    Sequence<bool>* both = bits.Concat(ones);
+    assert(both->GetLength() == 175 && both->Get(174));
+    delete ones; delete both;
+
+    // Знаковое поле в 4 бита держит [-8, 7], беззнаковое - [0, 15]
+    PackedSequence<unsigned, 4> nibbles;
+    for (unsigned i = 0; i < 20; ++i) nibbles.Append(i % 16);
+    assert(nibbles.Reduce([](unsigned x, unsigned acc) { return acc + x; }, 0u) == 120 + 6);
+    bool thrown = false;
+    try { nibbles.Append(16); } catch (const MyException&) { thrown = true; }
+    assert(thrown && nibbles.GetLength() == 20);
+    assert(static_reduce(nibbles, [](unsigned x, unsigned acc) { return acc > x ? acc : x; }, 0u) == 15);
+    PackedSequence<int, 4> small;
+    thrown = false;
+    try { small.Append(8); } catch (const MyException&) { thrown = true; }
+    assert(thrown);
+}
+
+// Сравнение только по ключу: второе поле - порядок добавления
+struct ByKey {
+    bool operator()(const std::pair<int, int>& a, const std::pair<int, int>& b) const {
+        return a.first < b.first;
+    }
+};
+
+void TestSortedSequence()
+{
+    int raw[] = {5, 1, 4, 1, 3, 9, 2, 6};
+    SortedSequence<int> s(raw, 8);
+    checkEqual(s, {1,1,2,3,4,5,6,9});
+    assert(s.LowerBound(1) == 0 && s.UpperBound(1) == 2 && s.Count(1) == 2);
+    assert(s.LowerBound(0) == 0 && s.LowerBound(7) == 7 && s.LowerBound(10) == 8);
+    assert(s.Contains(6) && !s.Contains(7) && s.IndexOf(9) == 7 && s.IndexOf(8) == -1);
+
+    assert(s.Add(4) == 5);
+    s.Append(0);
+    s.InsertAt(10, 0);
+    checkEqual(s, {0,1,1,2,3,4,4,5,6,9,10});
+    assert(s.Remove(4) && !s.Remove(7));
+    int batch[] = {8, 2, 11, 0};
+    s.AddRange(batch, 4);
+    checkEqual(s, {0,0,1,1,2,2,3,4,5,6,8,9,10,11});
+
+    int xs[] = {1, 2, 2, 3, 5};
+    int ys[] = {2, 3, 3, 4};
+    SortedSequence<int> a(xs, 5), b(ys, 4);
+    SortedSequence<int>* merged = a.Merge(b);
+    SortedSequence<int>* united = a.Union(b);
+    SortedSequence<int>* common = a.Intersection(b);
+    SortedSequence<int>* rest = a.Difference(b);
+    checkEqual(*merged, {1,2,2,2,3,3,3,4,5});
+    checkEqual(*united, {1,2,2,3,3,4,5});
+    checkEqual(*common, {2,3});
+    checkEqual(*rest, {1,2,5});
+    delete merged; delete united; delete common; delete rest;
+
+    // Случайные данные против std::lower_bound/upper_bound
+    std::vector<int> ref;
+    SortedSequence<int, std::greater<int>> desc;
+    for (int i = 0; i < 2000; ++i) {
+        int v = (i * 7919) % 257;
+        ref.push_back(v);
+        desc.Add(v);
+    }
+    std::sort(ref.begin(), ref.end(), std::greater<int>());
+    for (int i = 0; i < desc.GetLength(); ++i) assert(desc.Get(i) == ref[i]);
+    for (int v = -1; v <= 258; ++v) {
+        assert(desc.LowerBound(v) == std::lower_bound(ref.begin(), ref.end(), v, std::greater<int>()) - ref.begin());
+        assert(desc.UpperBound(v) == std::upper_bound(ref.begin(), ref.end(), v, std::greater<int>()) - ref.begin());
+    }
+
+    ListSequence<int> unsorted{7, -1, 3};
+    Sequence<int>* joined = a.Concat(&unsorted);
+    checkEqual(*joined, {-1,1,2,2,3,3,5,7});
+    delete joined;
+
+    // Равные по ключу идут в порядке добавления, в том числе внутри пачки
+    std::vector<std::pair<int, int>> tagged;
+    for (int i = 0; i < 400; ++i) tagged.push_back({(i * 7) % 3, i});
+    SortedSequence<std::pair<int, int>, ByKey> stable(tagged.data(), 200);
+    stable.AppendRange(tagged.data() + 200, 200);
+    assert(stable.GetLength() == 400);
+    for (int i = 1; i < 400; ++i) {
+        std::pair<int, int> prev = stable.Get(i - 1), cur = stable.Get(i);
+        assert(prev.first < cur.first || (prev.first == cur.first && prev.second < cur.second));
+    }
+}
+
 int main()
 {
     std::cout<<"Running tests...\n";
@@ -184,6 +1222,26 @@ int main()
     TestReverseTwice<ArraySequence<int>>();
     TestReverseTwice<ListSequence<int>>();
     TestCycleSmartReverse();
+    TestParallelFunctions();
+    TestSorting();
+    TestDequeSequence();
+    ReverseScenarios<DequeSequence<int>>("DequeSequence");
+    TestTreapSequence();
+    TestSequenceView();
+    TestMonadTuple();
+    TestZippedSequence();
+    TestArraySequenceStorage();
+    TestCheckPolicies();
+    TestRangeOperations();
+    TestListSplice();
+    TestIndexedListSequence();
+    TestSimdKernels();
+    TestMappedArraySequence();
+    TestConcurrentSequence();
+    TestStaticDispatch();
+    TestSequenceStats();
+    TestPackedSequence();
+    TestSortedSequence();
 
     std::cout<<"All tests passed successfully!\n";
     return 0;